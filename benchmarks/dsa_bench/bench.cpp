@@ -0,0 +1,118 @@
+#include "bench.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+namespace dsa_bench
+{
+namespace
+{
+int64_t now_ns()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+} // namespace
+
+State::State(const size_t iterations) : iterations_(iterations), paused_ns_(0), pause_start_ns_(0)
+{
+}
+
+size_t State::iterations() const
+{
+    return iterations_;
+}
+
+void State::pause_timing()
+{
+    pause_start_ns_ = now_ns();
+}
+
+void State::resume_timing()
+{
+    paused_ns_ += now_ns() - pause_start_ns_;
+}
+
+double State::paused_seconds() const
+{
+    return static_cast<double>(paused_ns_) * 1e-9;
+}
+
+void Registry::add(const std::string& module, const std::string& operation, const std::string& variant, const size_t size,
+                   const size_t elem_size, const size_t items_per_iteration, std::function<void(State&)> body)
+{
+    Benchmark benchmark;
+    benchmark.name = module + "/" + operation + "/" + variant + "/" + std::to_string(size);
+    benchmark.module = module;
+    benchmark.size = size;
+    benchmark.elem_size = elem_size;
+    benchmark.items_per_iteration = items_per_iteration;
+    benchmark.body = std::move(body);
+    benchmarks_.push_back(std::move(benchmark));
+}
+
+const std::vector<Benchmark>& Registry::benchmarks() const
+{
+    return benchmarks_;
+}
+
+Random::Random(const uint64_t seed) : state_(seed)
+{
+}
+
+uint64_t Random::next()
+{
+    // splitmix64
+    uint64_t z = (state_ += 0x9E3779B97F4A7C15u);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9u;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBu;
+    return z ^ (z >> 31);
+}
+
+uint64_t Random::below(const uint64_t bound)
+{
+    return next() % bound;
+}
+
+const char* pattern_name(const Pattern pattern)
+{
+    switch (pattern)
+    {
+    case Pattern::random:
+        return "random";
+    case Pattern::sorted:
+        return "sorted";
+    case Pattern::reversed:
+        return "reversed";
+    case Pattern::few_unique:
+        return "few_unique";
+    }
+    return "unknown";
+}
+
+std::vector<int64_t> make_keys(const size_t size, const Pattern pattern, Random& random)
+{
+    std::vector<int64_t> keys(size);
+
+    for (size_t i = 0; i < size; i++)
+    {
+        switch (pattern)
+        {
+        case Pattern::random:
+            keys[i] = static_cast<int64_t>(random.next() >> 1);
+            break;
+        case Pattern::sorted:
+            keys[i] = static_cast<int64_t>(i);
+            break;
+        case Pattern::reversed:
+            keys[i] = static_cast<int64_t>(size - i);
+            break;
+        case Pattern::few_unique:
+            keys[i] = static_cast<int64_t>(random.below(8));
+            break;
+        }
+    }
+
+    return keys;
+}
+} // namespace dsa_bench
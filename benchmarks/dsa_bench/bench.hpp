@@ -0,0 +1,147 @@
+// Minimal benchmark harness shared by the dsa_bench modules.
+//
+// A benchmark body runs `state.iterations()` times the operation being measured. The harness
+// grows the iteration count until one run takes at least the minimum time, then repeats the
+// run and reports the median, which keeps results stable on a noisy machine.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace dsa_bench
+{
+class State
+{
+public:
+    explicit State(const size_t iterations);
+
+    size_t iterations() const;
+
+    // Excludes the work between the two calls, e.g. restoring an unsorted input, from the timing.
+    void pause_timing();
+    void resume_timing();
+
+    double paused_seconds() const;
+
+private:
+    size_t iterations_;
+    int64_t paused_ns_;
+    int64_t pause_start_ns_;
+};
+
+struct Benchmark
+{
+    // Unique name of the form "<module>/<operation>/<variant>/<size>", used by filters and baselines.
+    std::string name;
+    std::string module;
+    size_t size;
+    size_t elem_size;
+    // Elements processed by one iteration, used to report a per-element time.
+    size_t items_per_iteration;
+    std::function<void(State&)> body;
+};
+
+class Registry
+{
+public:
+    void add(const std::string& module, const std::string& operation, const std::string& variant, const size_t size,
+             const size_t elem_size, const size_t items_per_iteration, std::function<void(State&)> body);
+
+    const std::vector<Benchmark>& benchmarks() const;
+
+private:
+    std::vector<Benchmark> benchmarks_;
+};
+
+void register_sort_benchmarks(Registry& registry);
+void register_search_benchmarks(Registry& registry);
+void register_list_benchmarks(Registry& registry);
+void register_utility_benchmarks(Registry& registry);
+void register_numeric_benchmarks(Registry& registry);
+
+// Keeps the compiler from discarding a computation whose result is otherwise unused.
+template <typename T>
+inline void do_not_optimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+// Deterministic pseudo-random numbers, so every run measures the same inputs.
+class Random
+{
+public:
+    explicit Random(const uint64_t seed = 0x9E3779B97F4A7C15u);
+
+    uint64_t next();
+    uint64_t below(const uint64_t bound);
+
+private:
+    uint64_t state_;
+};
+
+// Input orders used by the sort benchmarks.
+enum class Pattern
+{
+    random,
+    sorted,
+    reversed,
+    few_unique,
+};
+
+const char* pattern_name(const Pattern pattern);
+
+// A key followed by a payload, standing in for records rather than plain numbers.
+struct Record32
+{
+    int64_t key;
+    char payload[24];
+};
+
+template <typename T>
+T from_key(const int64_t key)
+{
+    if constexpr (std::is_same_v<T, Record32>)
+    {
+        return Record32{key, {}};
+    }
+    else
+    {
+        return static_cast<T>(key);
+    }
+}
+
+template <typename T>
+int64_t key_of(const T& value)
+{
+    if constexpr (std::is_same_v<T, Record32>)
+    {
+        return value.key;
+    }
+    else
+    {
+        return static_cast<int64_t>(value);
+    }
+}
+
+// Comparison callback in the form the library expects.
+template <typename T>
+int compare_keys(const void* a, const void* b)
+{
+    const int64_t lhs = key_of(*static_cast<const T*>(a));
+    const int64_t rhs = key_of(*static_cast<const T*>(b));
+    return (lhs > rhs) - (lhs < rhs);
+}
+
+// Returns `size` keys in the requested order; few_unique draws from 8 distinct values.
+std::vector<int64_t> make_keys(const size_t size, const Pattern pattern, Random& random);
+} // namespace dsa_bench
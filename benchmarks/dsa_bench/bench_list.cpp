@@ -0,0 +1,179 @@
+#include "bench.hpp"
+
+#include "dsa/list/deque.h"
+#include "dsa/list/skiplist.h"
+#include "dsa/list/slist.h"
+#include "dsa/vector/vector.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace dsa_bench
+{
+namespace
+{
+int value = 0;
+
+void count_element(void* data, void* ctx)
+{
+    do_not_optimize(data);
+    ++*static_cast<size_t*>(ctx);
+}
+
+void add_slist(Registry& registry, const size_t size)
+{
+    registry.add("list", "slist_push_back", "ptr", size, sizeof(void*), size, [size](State& state) {
+        slist_t list = nullptr;
+        dsa_slist_create(&list, nullptr);
+        for (size_t i = 0; i < state.iterations(); i++)
+        {
+            for (size_t j = 0; j < size; j++)
+            {
+                dsa_slist_push_back(list, &value);
+            }
+
+            state.pause_timing();
+            dsa_slist_clear(list);
+            state.resume_timing();
+        }
+        dsa_slist_destroy(list);
+    });
+
+    registry.add("list", "slist_push_pop_front", "ptr", size, sizeof(void*), size, [size](State& state) {
+        slist_t list = nullptr;
+        dsa_slist_create(&list, nullptr);
+        for (size_t i = 0; i < state.iterations(); i++)
+        {
+            for (size_t j = 0; j < size; j++)
+            {
+                dsa_slist_push_front(list, &value);
+            }
+            for (size_t j = 0; j < size; j++)
+            {
+                dsa_slist_pop_front(list);
+            }
+        }
+        dsa_slist_destroy(list);
+    });
+
+    registry.add("list", "slist_for_each", "ptr", size, sizeof(void*), size, [size](State& state) {
+        slist_t list = nullptr;
+        dsa_slist_create(&list, nullptr);
+        for (size_t j = 0; j < size; j++)
+        {
+            dsa_slist_push_back(list, &value);
+        }
+
+        size_t visited = 0;
+        for (size_t i = 0; i < state.iterations(); i++)
+        {
+            dsa_slist_for_each(list, count_element, &visited);
+        }
+        do_not_optimize(visited);
+        dsa_slist_destroy(list);
+    });
+}
+
+void add_deque(Registry& registry, const size_t size)
+{
+    registry.add("list", "deque_push_back_pop_front", "ptr", size, sizeof(void*), size, [size](State& state) {
+        deque_t deque = nullptr;
+        dsa_deque_create(&deque, nullptr);
+        for (size_t i = 0; i < state.iterations(); i++)
+        {
+            for (size_t j = 0; j < size; j++)
+            {
+                dsa_deque_push_back(deque, &value);
+            }
+            for (size_t j = 0; j < size; j++)
+            {
+                dsa_deque_pop_front(deque);
+            }
+        }
+        dsa_deque_destroy(deque);
+    });
+}
+
+void add_skiplist(Registry& registry, const size_t size)
+{
+    registry.add("list", "skiplist_insert", "i64", size, sizeof(int64_t), size, [size](State& state) {
+        state.pause_timing();
+        Random random;
+        const std::vector<int64_t> keys = make_keys(size, Pattern::random, random);
+        skiplist_t list = nullptr;
+        dsa_skiplist_create(&list, compare_keys<int64_t>, nullptr);
+        state.resume_timing();
+
+        for (size_t i = 0; i < state.iterations(); i++)
+        {
+            for (const int64_t& key : keys)
+            {
+                dsa_skiplist_insert(list, const_cast<int64_t*>(&key), nullptr);
+            }
+
+            state.pause_timing();
+            dsa_skiplist_clear(list);
+            state.resume_timing();
+        }
+        dsa_skiplist_destroy(list);
+    });
+
+    registry.add("list", "skiplist_find", "i64", size, sizeof(int64_t), size, [size](State& state) {
+        state.pause_timing();
+        Random random;
+        std::vector<int64_t> keys = make_keys(size, Pattern::random, random);
+        skiplist_t list = nullptr;
+        dsa_skiplist_create(&list, compare_keys<int64_t>, nullptr);
+        for (int64_t& key : keys)
+        {
+            dsa_skiplist_insert(list, &key, nullptr);
+        }
+        state.resume_timing();
+
+        void* found = nullptr;
+        for (size_t i = 0; i < state.iterations(); i++)
+        {
+            for (const int64_t& key : keys)
+            {
+                dsa_skiplist_find(list, &key, &found);
+                do_not_optimize(found);
+            }
+        }
+        dsa_skiplist_destroy(list);
+    });
+}
+
+void add_vector(Registry& registry, const size_t size)
+{
+    registry.add("vector", "push_back", "i64", size, sizeof(int64_t), size, [size](State& state) {
+        vector_t vector = nullptr;
+        dsa_vector_create(&vector, sizeof(int64_t), alignof(int64_t), nullptr);
+        for (size_t i = 0; i < state.iterations(); i++)
+        {
+            for (size_t j = 0; j < size; j++)
+            {
+                const int64_t element = static_cast<int64_t>(j);
+                dsa_vector_push_back(vector, &element);
+            }
+
+            state.pause_timing();
+            dsa_vector_clear(vector);
+            dsa_vector_shrink_to_fit(vector);
+            state.resume_timing();
+        }
+        dsa_vector_destroy(vector);
+    });
+}
+} // namespace
+
+void register_list_benchmarks(Registry& registry)
+{
+    for (const size_t size : {1024u, 65536u})
+    {
+        add_slist(registry, size);
+        add_deque(registry, size);
+        add_skiplist(registry, size);
+        add_vector(registry, size);
+    }
+}
+} // namespace dsa_bench
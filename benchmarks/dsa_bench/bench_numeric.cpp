@@ -0,0 +1,117 @@
+#include "bench.hpp"
+
+#include "dsa/numeric/lsqe.h"
+#include "dsa/numeric/polynomial_interpolation.h"
+#include "dsa/numeric/root.h"
+
+#include <cmath>
+#include <vector>
+
+namespace dsa_bench
+{
+namespace
+{
+double cubic(const double x)
+{
+    return x * x * x - 2.0 * x - 5.0;
+}
+
+double cubic_derivative(const double x)
+{
+    return 3.0 * x * x - 2.0;
+}
+
+void add_lsqe(Registry& registry, const size_t size)
+{
+    registry.add("numeric", "lsqe", "f64", size, sizeof(double), size, [size](State& state) {
+        state.pause_timing();
+        Random random;
+        std::vector<double> x(size);
+        std::vector<double> y(size);
+        for (size_t i = 0; i < size; i++)
+        {
+            x[i] = static_cast<double>(i);
+            y[i] = 3.0 * x[i] + 1.0 + static_cast<double>(random.below(1000)) * 1e-3;
+        }
+        state.resume_timing();
+
+        double a = 0.0;
+        double b = 0.0;
+        for (size_t i = 0; i < state.iterations(); i++)
+        {
+            dsa_lsqe(x.data(), y.data(), size, &a, &b);
+            do_not_optimize(a);
+            do_not_optimize(b);
+        }
+    });
+}
+
+// Interpolates sin() on `nodes` points and evaluates the polynomial at 1024 points.
+void add_interpolation(Registry& registry, const size_t nodes)
+{
+    constexpr size_t points = 1024;
+
+    std::vector<double> x(nodes);
+    std::vector<double> fx(nodes);
+    for (size_t i = 0; i < nodes; i++)
+    {
+        x[i] = static_cast<double>(i) / static_cast<double>(nodes);
+        fx[i] = std::sin(x[i]);
+    }
+
+    registry.add("numeric", "newton_coefficients", "f64", nodes, sizeof(double), nodes, [x, fx](State& state) {
+        std::vector<double> coefficients(x.size());
+        for (size_t i = 0; i < state.iterations(); i++)
+        {
+            dsa_interpolation_find_newton_coefficients(x.data(), fx.data(), coefficients.data(), x.size());
+            do_not_optimize(coefficients.data());
+        }
+    });
+
+    registry.add("numeric", "newton_evaluate", "f64", nodes, sizeof(double), points, [x, fx](State& state) {
+        std::vector<double> coefficients(x.size());
+        dsa_interpolation_find_newton_coefficients(x.data(), fx.data(), coefficients.data(), x.size());
+
+        std::vector<double> z(points);
+        std::vector<double> pz(points);
+        for (size_t i = 0; i < points; i++)
+        {
+            z[i] = static_cast<double>(i) / static_cast<double>(points);
+        }
+
+        for (size_t i = 0; i < state.iterations(); i++)
+        {
+            dsa_interpolation_evaluate_newton_polynomial(x.data(), coefficients.data(), x.size(), z.data(), pz.data(), points);
+            do_not_optimize(pz.data());
+        }
+    });
+}
+
+void add_root(Registry& registry)
+{
+    registry.add("numeric", "find_root_newton", "f64", 1, sizeof(double), 1, [](State& state) {
+        double x[64] = {};
+        for (size_t i = 0; i < state.iterations(); i++)
+        {
+            x[0] = 2.0;
+            size_t n = 64;
+            dsa_find_root_newton(cubic, cubic_derivative, x, &n, 1e-12);
+            do_not_optimize(x[n - 1]);
+        }
+    });
+}
+} // namespace
+
+void register_numeric_benchmarks(Registry& registry)
+{
+    for (const size_t size : {1024u, 65536u})
+    {
+        add_lsqe(registry, size);
+    }
+    for (const size_t nodes : {8u, 32u, 128u})
+    {
+        add_interpolation(registry, nodes);
+    }
+    add_root(registry);
+}
+} // namespace dsa_bench
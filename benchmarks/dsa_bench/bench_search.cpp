@@ -0,0 +1,57 @@
+#include "bench.hpp"
+
+#include "dsa/search/binary_search.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace dsa_bench
+{
+namespace
+{
+// Lookups per iteration, so the loop overhead stays small compared with a single search.
+constexpr size_t lookups = 256;
+
+template <typename T>
+void add_binary_search(Registry& registry, const char* type, const size_t size)
+{
+    registry.add("search", "binary_search_index", type, size, sizeof(T), lookups, [size](State& state) {
+        // Even keys are stored and every other lookup searches for an odd, missing key.
+        state.pause_timing();
+        std::vector<T> sorted(size);
+        for (size_t i = 0; i < size; i++)
+        {
+            sorted[i] = from_key<T>(static_cast<int64_t>(2 * i));
+        }
+
+        Random random;
+        std::vector<T> targets(lookups);
+        for (size_t i = 0; i < lookups; i++)
+        {
+            targets[i] = from_key<T>(static_cast<int64_t>(2 * random.below(size) + (i & 1)));
+        }
+        state.resume_timing();
+
+        size_t found = 0;
+        for (size_t i = 0; i < state.iterations(); i++)
+        {
+            for (const T& target : targets)
+            {
+                dsa_binary_search_index(&target, sorted.data(), sorted.size(), sizeof(T), compare_keys<T>, &found);
+                do_not_optimize(found);
+            }
+        }
+    });
+}
+} // namespace
+
+void register_search_benchmarks(Registry& registry)
+{
+    for (const size_t size : {1024u, 65536u, 1048576u})
+    {
+        add_binary_search<int32_t>(registry, "i32", size);
+        add_binary_search<int64_t>(registry, "i64", size);
+        add_binary_search<Record32>(registry, "rec32", size);
+    }
+}
+} // namespace dsa_bench
@@ -0,0 +1,53 @@
+#include "bench.hpp"
+
+#include "dsa/sort/insertion_sort.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace dsa_bench
+{
+namespace
+{
+template <typename T>
+void add_insertion_sort(Registry& registry, const char* type, const size_t size, const Pattern pattern)
+{
+    Random random;
+    const std::vector<int64_t> keys = make_keys(size, pattern, random);
+
+    std::vector<T> input(size);
+    std::transform(keys.begin(), keys.end(), input.begin(), from_key<T>);
+
+    registry.add("sort", "insertion_sort", std::string(type) + "_" + pattern_name(pattern), size, sizeof(T), size,
+                 [input](State& state) {
+                     std::vector<T> work(input.size());
+                     for (size_t i = 0; i < state.iterations(); i++)
+                     {
+                         state.pause_timing();
+                         std::copy(input.begin(), input.end(), work.begin());
+                         state.resume_timing();
+
+                         dsa_insertion_sort(work.data(), work.size(), sizeof(T), compare_keys<T>);
+                         do_not_optimize(work.data());
+                     }
+                 });
+}
+} // namespace
+
+void register_sort_benchmarks(Registry& registry)
+{
+    const Pattern patterns[] = {Pattern::random, Pattern::sorted, Pattern::reversed, Pattern::few_unique};
+
+    for (const size_t size : {16u, 256u, 2048u})
+    {
+        for (const Pattern pattern : patterns)
+        {
+            add_insertion_sort<int32_t>(registry, "i32", size, pattern);
+            add_insertion_sort<int64_t>(registry, "i64", size, pattern);
+            add_insertion_sort<Record32>(registry, "rec32", size, pattern);
+        }
+    }
+}
+} // namespace dsa_bench
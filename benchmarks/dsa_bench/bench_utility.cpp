@@ -0,0 +1,168 @@
+#include "bench.hpp"
+
+#include "dsa/common/cpu.h"
+#include "dsa/utility/max_element.h"
+#include "dsa/utility/min_element.h"
+#include "dsa/utility/minmax_element.h"
+#include "dsa/utility/reduce.h"
+#include "dsa/utility/reverse.h"
+#include "dsa/utility/scan.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace dsa_bench
+{
+namespace
+{
+template <typename T>
+std::vector<T> make_values(const size_t size)
+{
+    Random random;
+    std::vector<T> values(size);
+    for (T& value : values)
+    {
+        value = static_cast<T>(static_cast<int64_t>(random.below(2000001)) - 1000000);
+    }
+    return values;
+}
+
+// Runs `body` with the portable kernels if `scalar` is set, or with the best ones otherwise.
+template <typename Body>
+void with_level(const bool scalar, Body body)
+{
+    if (scalar)
+    {
+        dsa_cpu_force_level(DSA_CPU_LEVEL_SCALAR);
+    }
+    body();
+    dsa_cpu_force_level(dsa_cpu_detect());
+}
+
+void add_reduce(Registry& registry, const size_t size)
+{
+    registry.add("utility", "reduce_sum", "i32", size, sizeof(int32_t), size, [size](State& state) {
+        state.pause_timing();
+        const std::vector<int32_t> values = make_values<int32_t>(size);
+        state.resume_timing();
+
+        int64_t sum = 0;
+        for (size_t i = 0; i < state.iterations(); i++)
+        {
+            dsa_reduce_sum_i32(values.data(), values.size(), &sum);
+            do_not_optimize(sum);
+        }
+    });
+
+    registry.add("utility", "reduce_sum", "f64", size, sizeof(double), size, [size](State& state) {
+        state.pause_timing();
+        const std::vector<double> values = make_values<double>(size);
+        state.resume_timing();
+
+        double sum = 0.0;
+        for (size_t i = 0; i < state.iterations(); i++)
+        {
+            dsa_reduce_sum_f64(values.data(), values.size(), &sum);
+            do_not_optimize(sum);
+        }
+    });
+}
+
+// The typed min/max searches are measured with both the portable and the dispatched kernels.
+void add_element_index(Registry& registry, const size_t size)
+{
+    for (const bool scalar : {true, false})
+    {
+        const std::string level = scalar ? "scalar" : "dispatch";
+
+        registry.add("utility", "min_element_index", "f64_" + level, size, sizeof(double), size, [size, scalar](State& state) {
+            state.pause_timing();
+            const std::vector<double> values = make_values<double>(size);
+            state.resume_timing();
+
+            with_level(scalar, [&] {
+                size_t index = 0;
+                for (size_t i = 0; i < state.iterations(); i++)
+                {
+                    dsa_min_element_index_f64(values.data(), values.size(), &index);
+                    do_not_optimize(index);
+                }
+            });
+        });
+
+        registry.add("utility", "max_element_index", "i32_" + level, size, sizeof(int32_t), size, [size, scalar](State& state) {
+            state.pause_timing();
+            const std::vector<int32_t> values = make_values<int32_t>(size);
+            state.resume_timing();
+
+            with_level(scalar, [&] {
+                size_t index = 0;
+                for (size_t i = 0; i < state.iterations(); i++)
+                {
+                    dsa_max_element_index_i32(values.data(), values.size(), &index);
+                    do_not_optimize(index);
+                }
+            });
+        });
+    }
+
+    registry.add("utility", "minmax_element_index", "i64", size, sizeof(int64_t), size, [size](State& state) {
+        state.pause_timing();
+        const std::vector<int64_t> values = make_values<int64_t>(size);
+        state.resume_timing();
+
+        size_t min_index = 0;
+        size_t max_index = 0;
+        for (size_t i = 0; i < state.iterations(); i++)
+        {
+            dsa_minmax_element_index(values.data(), values.size(), sizeof(int64_t), compare_keys<int64_t>, &min_index, &max_index);
+            do_not_optimize(min_index);
+            do_not_optimize(max_index);
+        }
+    });
+}
+
+void add_scan(Registry& registry, const size_t size)
+{
+    registry.add("utility", "inclusive_scan_sum", "f64", size, sizeof(double), size, [size](State& state) {
+        state.pause_timing();
+        const std::vector<double> values = make_values<double>(size);
+        std::vector<double> out(size);
+        state.resume_timing();
+
+        for (size_t i = 0; i < state.iterations(); i++)
+        {
+            dsa_inclusive_scan_sum_f64(values.data(), out.data(), values.size(), nullptr);
+            do_not_optimize(out.data());
+        }
+    });
+}
+
+void add_reverse(Registry& registry, const size_t size)
+{
+    for (const size_t elem_size : {1u, 4u, 8u, 16u})
+    {
+        registry.add("utility", "reverse", "b" + std::to_string(elem_size), size, elem_size, size, [size, elem_size](State& state) {
+            std::vector<unsigned char> bytes(size * elem_size, 0x5A);
+            for (size_t i = 0; i < state.iterations(); i++)
+            {
+                dsa_reverse(bytes.data(), size, elem_size);
+                do_not_optimize(bytes.data());
+            }
+        });
+    }
+}
+} // namespace
+
+void register_utility_benchmarks(Registry& registry)
+{
+    for (const size_t size : {1024u, 65536u, 1048576u})
+    {
+        add_reduce(registry, size);
+        add_element_index(registry, size);
+        add_scan(registry, size);
+        add_reverse(registry, size);
+    }
+}
+} // namespace dsa_bench
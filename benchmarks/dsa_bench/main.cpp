@@ -0,0 +1,513 @@
+// Benchmark suite covering the sort, search, list, vector, utility and numeric modules.
+//
+// Usage: dsa_bench [--filter <substring>] [--json <file>|-] [--min-time <seconds>]
+//                  [--repetitions <count>] [--list]
+//                  [--baseline <file> [--tolerance <fraction>] [--update-baseline]]
+//
+// A table is printed to stdout; `--json` additionally writes the results in a
+// machine-readable form, to stdout instead of the table when the file is `-`.
+//
+// With `--baseline`, only the benchmarks named in the baseline file (a previous JSON
+// output) are run, and the program fails if the fastest repetition of any of them is
+// slower than the baseline by more than the tolerance (default 0.25, i.e. 25%). Apparent
+// regressions are measured again before they are reported.
+// `--update-baseline` instead writes the results of all benchmarks to the file, creating it
+// if needed.
+//
+// Absolute timings are only comparable on the machine and build that recorded them. When
+// the host, CPU, compiler, build type or CPU feature level in the baseline's context differ
+// from the current ones, the comparison is skipped and the program exits with code 77.
+
+#include "bench.hpp"
+
+#include "dsa/common/cpu.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+    #define NOMINMAX
+    #include <windows.h>
+#else
+    #include <unistd.h>
+#endif
+
+namespace
+{
+// Exit code reported when the baseline was recorded elsewhere; CTest treats it as a skip.
+constexpr int skip_exit_code = 77;
+
+struct Options
+{
+    std::string filter;
+    std::string json_path;
+    double min_time = 0.05;
+    size_t repetitions = 5;
+    bool list_only = false;
+    std::string baseline_path;
+    double tolerance = 0.25;
+    bool update_baseline = false;
+};
+
+struct Result
+{
+    const dsa_bench::Benchmark* benchmark;
+    size_t iterations;
+    double median_ns;
+    double min_ns;
+    double max_ns;
+};
+
+void print_usage()
+{
+    std::fprintf(stderr, "usage: dsa_bench [--filter <substring>] [--json <file>|-] [--min-time <seconds>] "
+                         "[--repetitions <count>] [--list]\n"
+                         "                 [--baseline <file> [--tolerance <fraction>] [--update-baseline]]\n");
+}
+
+bool parse_options(const int argc, char** argv, Options& options)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        const char* arg = argv[i];
+        const bool has_value = i + 1 < argc;
+
+        if (std::strcmp(arg, "--filter") == 0 && has_value)
+        {
+            options.filter = argv[++i];
+        }
+        else if (std::strcmp(arg, "--json") == 0 && has_value)
+        {
+            options.json_path = argv[++i];
+        }
+        else if (std::strcmp(arg, "--min-time") == 0 && has_value)
+        {
+            options.min_time = std::strtod(argv[++i], nullptr);
+        }
+        else if (std::strcmp(arg, "--repetitions") == 0 && has_value)
+        {
+            options.repetitions = std::max<size_t>(1, std::strtoull(argv[++i], nullptr, 10));
+        }
+        else if (std::strcmp(arg, "--list") == 0)
+        {
+            options.list_only = true;
+        }
+        else if (std::strcmp(arg, "--baseline") == 0 && has_value)
+        {
+            options.baseline_path = argv[++i];
+        }
+        else if (std::strcmp(arg, "--tolerance") == 0 && has_value)
+        {
+            options.tolerance = std::strtod(argv[++i], nullptr);
+        }
+        else if (std::strcmp(arg, "--update-baseline") == 0)
+        {
+            options.update_baseline = true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    // Updating with a filter would drop the filtered-out benchmarks from the baseline.
+    const bool valid_update = !options.update_baseline || (!options.baseline_path.empty() && options.filter.empty());
+    return options.min_time > 0.0 && options.tolerance >= 0.0 && valid_update;
+}
+
+// Returns the time of one iteration in nanoseconds, excluding paused intervals.
+double time_run(const dsa_bench::Benchmark& benchmark, const size_t iterations)
+{
+    dsa_bench::State state(iterations);
+
+    const auto start = std::chrono::steady_clock::now();
+    benchmark.body(state);
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    return std::max(0.0, seconds - state.paused_seconds()) * 1e9 / static_cast<double>(iterations);
+}
+
+Result run(const dsa_bench::Benchmark& benchmark, const Options& options)
+{
+    // Grow the iteration count until a single run lasts at least the minimum time.
+    size_t iterations = 1;
+    for (;;)
+    {
+        const double total_seconds = time_run(benchmark, iterations) * static_cast<double>(iterations) * 1e-9;
+        if (total_seconds >= options.min_time || iterations >= 1000000000)
+        {
+            break;
+        }
+
+        const double factor = total_seconds > 0.0 ? options.min_time * 1.4 / total_seconds : 10.0;
+        iterations = static_cast<size_t>(static_cast<double>(iterations) * std::clamp(factor, 2.0, 10.0));
+    }
+
+    std::vector<double> samples;
+    for (size_t r = 0; r < options.repetitions; r++)
+    {
+        samples.push_back(time_run(benchmark, iterations));
+    }
+    std::sort(samples.begin(), samples.end());
+
+    return Result{&benchmark, iterations, samples[samples.size() / 2], samples.front(), samples.back()};
+}
+
+std::string json_escape(const std::string& text)
+{
+    std::string escaped;
+    for (const char c : text)
+    {
+        if (c == '"' || c == '\\')
+        {
+            escaped += '\\';
+        }
+        escaped += c;
+    }
+    return escaped;
+}
+
+std::string compiler_name()
+{
+#if defined(__clang__)
+    return std::string("clang ") + __clang_version__;
+#elif defined(__GNUC__)
+    return std::string("gcc ") + __VERSION__;
+#elif defined(_MSC_VER)
+    return "msvc " + std::to_string(_MSC_VER);
+#else
+    return "unknown";
+#endif
+}
+
+std::string host_name()
+{
+#if defined(_WIN32)
+    char name[MAX_COMPUTERNAME_LENGTH + 1] = "";
+    DWORD length = sizeof(name);
+    return GetComputerNameA(name, &length) ? name : "unknown";
+#else
+    char name[256] = "";
+    return gethostname(name, sizeof(name) - 1) == 0 ? name : "unknown";
+#endif
+}
+
+std::string cpu_model()
+{
+    // Only Linux exposes the model name without platform-specific code.
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    for (std::string line; std::getline(cpuinfo, line);)
+    {
+        const size_t colon = line.find(':');
+        if (line.rfind("model name", 0) == 0 && colon != std::string::npos)
+        {
+            return line.substr(line.find_first_not_of(' ', colon + 1));
+        }
+    }
+    return "unknown";
+}
+
+const char* build_type()
+{
+#if defined(NDEBUG)
+    return "release";
+#else
+    return "debug";
+#endif
+}
+
+// The context fields that must match for timings to be comparable, in the current run.
+std::map<std::string, std::string> machine_context()
+{
+    return {
+        {"host", host_name()},
+        {"cpu", cpu_model()},
+        {"compiler", compiler_name()},
+        {"build_type", build_type()},
+        {"cpu_level", dsa_cpu_level_name(dsa_cpu_get_level())},
+    };
+}
+
+void write_json(std::FILE* out, const std::vector<Result>& results, const Options& options)
+{
+    char date[32] = "";
+    const std::time_t now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+    const std::map<std::string, std::string> context = machine_context();
+
+    std::fprintf(out, "{\n  \"context\": {\n");
+    std::fprintf(out, "    \"date\": \"%s\",\n", date);
+    std::fprintf(out, "    \"host\": \"%s\",\n", json_escape(context.at("host")).c_str());
+    std::fprintf(out, "    \"cpu\": \"%s\",\n", json_escape(context.at("cpu")).c_str());
+    std::fprintf(out, "    \"compiler\": \"%s\",\n", json_escape(context.at("compiler")).c_str());
+    std::fprintf(out, "    \"build_type\": \"%s\",\n", context.at("build_type").c_str());
+    std::fprintf(out, "    \"cpu_level\": \"%s\",\n", context.at("cpu_level").c_str());
+    std::fprintf(out, "    \"min_time\": %g,\n", options.min_time);
+    std::fprintf(out, "    \"repetitions\": %zu\n", options.repetitions);
+    std::fprintf(out, "  },\n  \"benchmarks\": [");
+
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        const Result& result = results[i];
+        const dsa_bench::Benchmark& benchmark = *result.benchmark;
+        const double items = static_cast<double>(benchmark.items_per_iteration);
+
+        std::fprintf(out, "%s\n    {\n", i == 0 ? "" : ",");
+        std::fprintf(out, "      \"name\": \"%s\",\n", json_escape(benchmark.name).c_str());
+        std::fprintf(out, "      \"module\": \"%s\",\n", json_escape(benchmark.module).c_str());
+        std::fprintf(out, "      \"size\": %zu,\n", benchmark.size);
+        std::fprintf(out, "      \"elem_size\": %zu,\n", benchmark.elem_size);
+        std::fprintf(out, "      \"iterations\": %zu,\n", result.iterations);
+        std::fprintf(out, "      \"ns_per_iteration\": %.3f,\n", result.median_ns);
+        std::fprintf(out, "      \"ns_per_iteration_min\": %.3f,\n", result.min_ns);
+        std::fprintf(out, "      \"ns_per_iteration_max\": %.3f,\n", result.max_ns);
+        std::fprintf(out, "      \"ns_per_item\": %.4f,\n", result.median_ns / items);
+        std::fprintf(out, "      \"items_per_second\": %.1f\n", result.median_ns > 0.0 ? items * 1e9 / result.median_ns : 0.0);
+        std::fprintf(out, "    }");
+    }
+
+    std::fprintf(out, "\n  ]\n}\n");
+}
+// Extracts a string field of the context; json_escape() only ever escapes quotes and backslashes.
+std::string read_context_field(const std::string& text, const std::string& key)
+{
+    const std::string field_key = "\"" + key + "\": \"";
+    const size_t start = text.find(field_key);
+    if (start == std::string::npos)
+    {
+        return "";
+    }
+
+    std::string value;
+    for (size_t i = start + field_key.size(); i < text.size() && text[i] != '"'; i++)
+    {
+        if (text[i] == '\\' && i + 1 < text.size())
+        {
+            ++i;
+        }
+        value += text[i];
+    }
+    return value;
+}
+
+// Reads the fastest time of every benchmark, and the machine context, from a file written by
+// `--json`. The file is only scanned for the fields this program writes itself, so no JSON
+// library is needed.
+bool read_baseline(const std::string& path, std::map<std::string, double>& baseline, std::map<std::string, std::string>& context)
+{
+    std::ifstream file(path);
+    if (!file)
+    {
+        return false;
+    }
+
+    std::stringstream contents;
+    contents << file.rdbuf();
+    const std::string text = contents.str();
+
+    for (const auto& entry : machine_context())
+    {
+        context[entry.first] = read_context_field(text, entry.first);
+    }
+
+    const std::string name_key = "\"name\": \"";
+    const std::string time_key = "\"ns_per_iteration_min\": ";
+
+    for (size_t pos = text.find(name_key); pos != std::string::npos; pos = text.find(name_key, pos))
+    {
+        pos += name_key.size();
+        const size_t name_end = text.find('"', pos);
+        const size_t time_pos = text.find(time_key, name_end);
+        if (name_end == std::string::npos || time_pos == std::string::npos)
+        {
+            return false;
+        }
+
+        baseline[text.substr(pos, name_end - pos)] = std::strtod(text.c_str() + time_pos + time_key.size(), nullptr);
+        pos = time_pos;
+    }
+
+    return !baseline.empty();
+}
+
+// Prints the comparison and returns the number of benchmarks slower than the tolerance allows.
+size_t compare_with_baseline(const std::vector<Result>& results, const std::map<std::string, double>& baseline, const double tolerance)
+{
+    size_t regressions = 0;
+
+    std::printf("%-52s %14s %14s %9s\n", "benchmark", "baseline ns", "current ns", "change");
+    for (const Result& result : results)
+    {
+        const double expected = baseline.at(result.benchmark->name);
+        const double change = expected > 0.0 ? result.min_ns / expected - 1.0 : 0.0;
+        const bool regressed = change > tolerance;
+
+        regressions += regressed ? 1 : 0;
+        std::printf("%-52s %14.1f %14.1f %+8.1f%%%s\n", result.benchmark->name.c_str(), expected, result.min_ns, change * 100.0,
+                    regressed ? "  REGRESSION" : "");
+    }
+
+    std::printf("%zu of %zu benchmarks regressed by more than %.0f%%\n", regressions, results.size(), tolerance * 100.0);
+    return regressions;
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!parse_options(argc, argv, options))
+    {
+        print_usage();
+        return EXIT_FAILURE;
+    }
+
+    dsa_bench::Registry registry;
+    dsa_bench::register_sort_benchmarks(registry);
+    dsa_bench::register_search_benchmarks(registry);
+    dsa_bench::register_list_benchmarks(registry);
+    dsa_bench::register_utility_benchmarks(registry);
+    dsa_bench::register_numeric_benchmarks(registry);
+
+    // An update records every benchmark matching the filter, whether or not the file already
+    // exists or names it, so the old baseline is not read at all.
+    std::map<std::string, double> baseline;
+    std::map<std::string, std::string> baseline_context;
+    if (!options.baseline_path.empty() && !options.update_baseline && !read_baseline(options.baseline_path, baseline, baseline_context))
+    {
+        std::fprintf(stderr, "dsa_bench: cannot read baseline %s\n", options.baseline_path.c_str());
+        return EXIT_FAILURE;
+    }
+
+    if (!baseline.empty() && !options.list_only)
+    {
+        bool same_machine = true;
+        for (const auto& [key, value] : machine_context())
+        {
+            if (baseline_context[key] != value)
+            {
+                std::printf("dsa_bench: baseline %s is \"%s\", this run is \"%s\"\n", key.c_str(), baseline_context[key].c_str(),
+                            value.c_str());
+                same_machine = false;
+            }
+        }
+
+        if (!same_machine)
+        {
+            std::printf("dsa_bench: skipping the comparison; record a baseline for this machine with --update-baseline\n");
+            return skip_exit_code;
+        }
+    }
+
+    std::vector<const dsa_bench::Benchmark*> selected;
+    for (const dsa_bench::Benchmark& benchmark : registry.benchmarks())
+    {
+        if (benchmark.name.find(options.filter) != std::string::npos && (baseline.empty() || baseline.count(benchmark.name) != 0))
+        {
+            selected.push_back(&benchmark);
+        }
+    }
+
+    // A renamed or removed benchmark would otherwise silently drop out of the comparison.
+    bool missing = false;
+    for (const auto& [name, time] : baseline)
+    {
+        const bool known = std::any_of(selected.begin(), selected.end(), [&](const dsa_bench::Benchmark* b) { return b->name == name; });
+        if (!known && name.find(options.filter) != std::string::npos)
+        {
+            std::fprintf(stderr, "dsa_bench: baseline benchmark %s does not exist\n", name.c_str());
+            missing = true;
+        }
+    }
+    if (missing)
+    {
+        return EXIT_FAILURE;
+    }
+
+    if (options.list_only)
+    {
+        for (const dsa_bench::Benchmark* benchmark : selected)
+        {
+            std::printf("%s\n", benchmark->name.c_str());
+        }
+        return EXIT_SUCCESS;
+    }
+
+    const bool json_to_stdout = options.json_path == "-";
+    const bool print_table = !json_to_stdout && baseline.empty();
+    if (print_table)
+    {
+        std::printf("%-52s %12s %14s %12s\n", "benchmark", "iterations", "ns/iteration", "ns/item");
+    }
+
+    std::vector<Result> results;
+    for (const dsa_bench::Benchmark* benchmark : selected)
+    {
+        results.push_back(run(*benchmark, options));
+
+        if (print_table)
+        {
+            const Result& result = results.back();
+            std::printf("%-52s %12zu %14.1f %12.3f\n", benchmark->name.c_str(), result.iterations, result.median_ns,
+                        result.median_ns / static_cast<double>(benchmark->items_per_iteration));
+            std::fflush(stdout);
+        }
+    }
+
+    if (!options.json_path.empty())
+    {
+        std::FILE* out = json_to_stdout ? stdout : std::fopen(options.json_path.c_str(), "w");
+        if (!out)
+        {
+            std::fprintf(stderr, "dsa_bench: cannot open %s\n", options.json_path.c_str());
+            return EXIT_FAILURE;
+        }
+
+        write_json(out, results, options);
+
+        if (!json_to_stdout)
+        {
+            std::fclose(out);
+        }
+    }
+
+    if (options.update_baseline)
+    {
+        std::FILE* out = std::fopen(options.baseline_path.c_str(), "w");
+        if (!out)
+        {
+            std::fprintf(stderr, "dsa_bench: cannot open %s\n", options.baseline_path.c_str());
+            return EXIT_FAILURE;
+        }
+
+        write_json(out, results, options);
+        std::fclose(out);
+        return EXIT_SUCCESS;
+    }
+
+    // Re-measure apparent regressions a few times to tell them apart from a noisy neighbour.
+    for (Result& result : results)
+    {
+        const auto expected = baseline.find(result.benchmark->name);
+        for (int attempt = 0; attempt < 3 && expected != baseline.end() && result.min_ns > expected->second * (1.0 + options.tolerance); attempt++)
+        {
+            result.min_ns = std::min(result.min_ns, run(*result.benchmark, options).min_ns);
+        }
+    }
+
+    if (!baseline.empty() && compare_with_baseline(results, baseline, options.tolerance) != 0)
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
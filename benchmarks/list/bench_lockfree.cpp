@@ -0,0 +1,181 @@
+// Throughput of the lock-free list containers compared with a mutex-protected slist.
+//
+// Usage: bench_lockfree [operations_per_thread]
+
+#include "dsa/list/lf_stack.h"
+#include "dsa/list/mpsc_queue.h"
+#include "dsa/list/slist.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+struct Message
+{
+    mpsc_queue_link_t link;
+};
+
+double run_threads(const size_t thread_count, const std::function<void(size_t)>& body)
+{
+    std::vector<std::thread> threads;
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t t = 0; t < thread_count; t++)
+    {
+        threads.emplace_back(body, t);
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Every thread alternates push and pop, so the stack stays small and contended.
+double bench_lf_stack(const size_t thread_count, const size_t operations)
+{
+    lf_stack_t stack = nullptr;
+    dsa_lf_stack_create(&stack, nullptr);
+    static int value = 0;
+
+    const double seconds = run_threads(thread_count, [&](size_t) {
+        void* data = nullptr;
+        for (size_t i = 0; i < operations; i++)
+        {
+            dsa_lf_stack_push(stack, &value);
+            dsa_lf_stack_pop(stack, &data);
+        }
+    });
+
+    dsa_lf_stack_destroy(stack);
+    return seconds;
+}
+
+double bench_locked_slist(const size_t thread_count, const size_t operations)
+{
+    slist_t list = nullptr;
+    dsa_slist_create(&list, nullptr);
+    std::mutex mutex;
+    static int value = 0;
+
+    const double seconds = run_threads(thread_count, [&](size_t) {
+        for (size_t i = 0; i < operations; i++)
+        {
+            {
+                std::lock_guard lock(mutex);
+                dsa_slist_push_front(list, &value);
+            }
+            {
+                std::lock_guard lock(mutex);
+                dsa_slist_pop_front(list);
+            }
+        }
+    });
+
+    dsa_slist_destroy(list);
+    return seconds;
+}
+
+// All threads but one produce; the last one consumes every message.
+double bench_mpsc_queue(const size_t thread_count, const size_t operations)
+{
+    const size_t producer_count = thread_count > 1 ? thread_count - 1 : 1;
+    mpsc_queue_t queue = nullptr;
+    dsa_mpsc_queue_create(&queue, nullptr);
+    std::vector<Message> messages(producer_count * operations);
+
+    const double seconds = run_threads(producer_count + 1, [&](size_t t) {
+        if (t < producer_count)
+        {
+            for (size_t i = 0; i < operations; i++)
+            {
+                dsa_mpsc_queue_push(queue, &messages[t * operations + i].link);
+            }
+            return;
+        }
+
+        mpsc_queue_link_t* link = nullptr;
+        for (size_t received = 0; received < messages.size();)
+        {
+            if (dsa_mpsc_queue_pop(queue, &link) == DSA_SUCCESS)
+            {
+                ++received;
+            }
+        }
+    });
+
+    dsa_mpsc_queue_destroy(queue);
+    return seconds;
+}
+
+double bench_locked_slist_queue(const size_t thread_count, const size_t operations)
+{
+    const size_t producer_count = thread_count > 1 ? thread_count - 1 : 1;
+    slist_t list = nullptr;
+    dsa_slist_create(&list, nullptr);
+    std::mutex mutex;
+    static int value = 0;
+
+    const double seconds = run_threads(producer_count + 1, [&](size_t t) {
+        if (t < producer_count)
+        {
+            for (size_t i = 0; i < operations; i++)
+            {
+                std::lock_guard lock(mutex);
+                dsa_slist_push_back(list, &value);
+            }
+            return;
+        }
+
+        for (size_t received = 0; received < producer_count * operations;)
+        {
+            std::lock_guard lock(mutex);
+            if (dsa_slist_pop_front(list) == DSA_SUCCESS)
+            {
+                ++received;
+            }
+        }
+    });
+
+    dsa_slist_destroy(list);
+    return seconds;
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const size_t operations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 200000;
+    const size_t max_threads = std::max<size_t>(2, std::thread::hardware_concurrency());
+
+    struct Benchmark
+    {
+        const char* name;
+        double (*run)(size_t, size_t);
+    };
+    const Benchmark benchmarks[] = {
+        {"lf_stack push+pop", bench_lf_stack},
+        {"mutex slist push+pop", bench_locked_slist},
+        {"mpsc_queue", bench_mpsc_queue},
+        {"mutex slist queue", bench_locked_slist_queue},
+    };
+
+    std::printf("%-24s %8s %14s\n", "benchmark", "threads", "Mops/s");
+    for (const Benchmark& benchmark : benchmarks)
+    {
+        for (size_t threads = 1; threads <= max_threads; threads *= 2)
+        {
+            const double seconds = benchmark.run(threads, operations);
+            const double total = static_cast<double>(threads * operations);
+            std::printf("%-24s %8zu %14.2f\n", benchmark.name, threads, total / seconds / 1e6);
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
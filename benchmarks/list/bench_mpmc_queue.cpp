@@ -0,0 +1,131 @@
+// Throughput of the bounded MPMC queue by producer and consumer count, compared with
+// a mutex-protected slist used as a queue.
+//
+// Usage: bench_mpmc_queue [items_per_producer] [capacity]
+
+#include "dsa/list/mpmc_queue.h"
+#include "dsa/list/slist.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+int value = 0;
+
+template <typename Producer, typename Consumer>
+double run(const size_t producers, const size_t consumers, Producer produce, Consumer consume)
+{
+    std::vector<std::thread> threads;
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t p = 0; p < producers; p++)
+    {
+        threads.emplace_back(produce);
+    }
+    for (size_t c = 0; c < consumers; c++)
+    {
+        threads.emplace_back(consume);
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+double bench_mpmc_queue(const size_t producers, const size_t consumers, const size_t items, const size_t capacity, const size_t batch)
+{
+    mpmc_queue_t queue = nullptr;
+    dsa_mpmc_queue_create(&queue, capacity, nullptr);
+    std::atomic<size_t> remaining{producers * items};
+
+    const double seconds = run(producers, consumers,
+        [&] {
+            std::vector<void*> input(batch, &value);
+            for (size_t sent = 0; sent < items;)
+            {
+                size_t pushed = 0;
+                if (dsa_mpmc_queue_try_push_n(queue, input.data(), std::min(batch, items - sent), &pushed) == DSA_FULL)
+                {
+                    std::this_thread::yield();
+                }
+                sent += pushed;
+            }
+        },
+        [&] {
+            std::vector<void*> output(batch);
+            while (remaining.load(std::memory_order_relaxed) > 0)
+            {
+                size_t popped = 0;
+                if (dsa_mpmc_queue_try_pop_n(queue, output.data(), batch, &popped) == DSA_EMPTY_LIST)
+                {
+                    std::this_thread::yield();
+                }
+                remaining.fetch_sub(popped, std::memory_order_relaxed);
+            }
+        });
+
+    dsa_mpmc_queue_destroy(queue);
+    return seconds;
+}
+
+double bench_locked_slist(const size_t producers, const size_t consumers, const size_t items)
+{
+    slist_t list = nullptr;
+    dsa_slist_create(&list, nullptr);
+    std::mutex mutex;
+    std::atomic<size_t> remaining{producers * items};
+
+    const double seconds = run(producers, consumers,
+        [&] {
+            for (size_t i = 0; i < items; i++)
+            {
+                std::lock_guard lock(mutex);
+                dsa_slist_push_back(list, &value);
+            }
+        },
+        [&] {
+            while (remaining.load(std::memory_order_relaxed) > 0)
+            {
+                std::lock_guard lock(mutex);
+                if (dsa_slist_pop_front(list) == DSA_SUCCESS)
+                {
+                    remaining.fetch_sub(1, std::memory_order_relaxed);
+                }
+            }
+        });
+
+    dsa_slist_destroy(list);
+    return seconds;
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const size_t items = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 200000;
+    const size_t capacity = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1024;
+    const size_t thread_counts[] = {1, 2, 4, 8};
+
+    std::printf("%-22s %9s %9s %12s\n", "benchmark", "producers", "consumers", "Mitems/s");
+    for (const size_t producers : thread_counts)
+    {
+        for (const size_t consumers : thread_counts)
+        {
+            const double total = static_cast<double>(producers * items) / 1e6;
+            std::printf("%-22s %9zu %9zu %12.2f\n", "mpmc_queue", producers, consumers,
+                total / bench_mpmc_queue(producers, consumers, items, capacity, 1));
+            std::printf("%-22s %9zu %9zu %12.2f\n", "mpmc_queue batch=16", producers, consumers,
+                total / bench_mpmc_queue(producers, consumers, items, capacity, 16));
+            std::printf("%-22s %9zu %9zu %12.2f\n", "mutex slist", producers, consumers,
+                total / bench_locked_slist(producers, consumers, items));
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -7,12 +7,25 @@ target_compile_features(build_flags
     INTERFACE
         c_std_17)
 
+if (DSA_ENABLE_STATS)
+    target_compile_definitions(build_flags
+        INTERFACE
+            DSA_ENABLE_STATS)
+endif()
+
+if (DSA_ENABLE_TRACING)
+    target_compile_definitions(build_flags
+        INTERFACE
+            DSA_ENABLE_TRACING)
+endif()
+
 if (CMAKE_C_COMPILER_ID STREQUAL "MSVC")
     target_compile_options(build_flags
         INTERFACE
             /W4             # Enable level 4 warnings
             /WX             # Treat warnings as errors
             /permissive-    # Enforce standard conformance
+            $<$<COMPILE_LANGUAGE:C>:/experimental:c11atomics> # Enable <stdatomic.h> in C
     )
 else()
     target_compile_options(build_flags
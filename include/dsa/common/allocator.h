@@ -0,0 +1,107 @@
+/**
+ * @file allocator.h
+ * @brief Pluggable memory allocator used by the containers and algorithms.
+ *
+ * Containers copy an allocator when they are created and use it for every allocation
+ * they make until they are destroyed. Functions that accept an allocator treat NULL as
+ * "the process default", which is the C library heap unless replaced with
+ * `dsa_allocator_set_default()`.
+ */
+
+#pragma once
+
+#include "dsa/common/error_codes.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Set of memory management callbacks with a shared context.
+ *
+ * Returned blocks must be suitably aligned for any fundamental type, as with `malloc()`.
+ * Deallocation and reallocation receive the size the block was requested with, so that
+ * pool and arena allocators need no per-block header.
+ */
+typedef struct
+{
+    /**
+     * @brief Allocates @p size bytes. Returns NULL on failure. @p size is never zero.
+     */
+    void* (*allocate)(void* ctx, size_t size);
+
+    /**
+     * @brief Resizes a block from @p old_size to @p new_size bytes, preserving its contents,
+     *        and returns NULL on failure, leaving the block untouched. May be NULL, in which
+     *        case the block is moved with `allocate`, `memcpy()` and `deallocate`.
+     */
+    void* (*reallocate)(void* ctx, void* ptr, size_t old_size, size_t new_size);
+
+    /**
+     * @brief Releases a block of @p size bytes. @p ptr is never NULL.
+     */
+    void (*deallocate)(void* ctx, void* ptr, size_t size);
+
+    /**
+     * @brief User-provided context passed to every callback. May be NULL.
+     */
+    void* ctx;
+} dsa_allocator_t;
+
+/**
+ * @brief Returns the allocator backed by `malloc()`, `realloc()` and `free()`.
+ */
+const dsa_allocator_t* dsa_allocator_system(void);
+
+/**
+ * @brief Returns the current process default allocator.
+ */
+const dsa_allocator_t* dsa_allocator_get_default(void);
+
+/**
+ * @brief Replaces the process default allocator.
+ *
+ * Only objects created afterwards are affected; existing containers keep the allocator
+ * they were created with. The allocator is referenced, not copied, so it must stay valid
+ * while it is the default.
+ *
+ * @param[in] allocator New default allocator, or NULL to restore `dsa_allocator_system()`.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if @p allocator lacks the
+ *         `allocate` or `deallocate` callback.
+ */
+dsa_error_code_t dsa_allocator_set_default(const dsa_allocator_t* allocator);
+
+/**
+ * @brief Allocates @p size bytes with @p allocator, or with the default allocator if it is NULL.
+ *
+ * @return Pointer to the block, or NULL if @p size is zero or the allocation failed.
+ */
+void* dsa_allocate(const dsa_allocator_t* allocator, const size_t size);
+
+/**
+ * @brief Resizes a block obtained from the same allocator.
+ *
+ * A NULL @p ptr behaves like `dsa_allocate()`. A zero @p new_size is not allowed.
+ *
+ * @return Pointer to the resized block, or NULL on failure, in which case @p ptr stays valid.
+ */
+void* dsa_reallocate(const dsa_allocator_t* allocator, void* ptr, const size_t old_size, const size_t new_size);
+
+/**
+ * @brief Releases a block obtained from the same allocator. Does nothing if @p ptr is NULL.
+ */
+void dsa_deallocate(const dsa_allocator_t* allocator, void* ptr, const size_t size);
+
+/**
+ * @brief Checks whether two allocators have the same callbacks and context.
+ *
+ * Memory obtained from one of two equal allocators may be released through the other.
+ */
+bool dsa_allocator_equals(const dsa_allocator_t* first, const dsa_allocator_t* second);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
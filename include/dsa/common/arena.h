@@ -0,0 +1,160 @@
+/**
+ * @file arena.h
+ * @brief Bump-pointer arena allocator with marks and constant-time reset.
+ *
+ * An arena hands out memory from large chunks by advancing an offset, so an allocation
+ * costs a few arithmetic instructions and individual blocks are never freed. Instead, all
+ * memory allocated after a mark is released at once with `dsa_arena_rewind()`, and all
+ * memory with `dsa_arena_reset()`. Chunks are kept for reuse until the arena is destroyed.
+ *
+ * Through `dsa_arena_get_allocator()` an arena can back any container or algorithm that
+ * accepts a @ref dsa_allocator_t, e.g. to build a per-request list, sort it, and discard
+ * everything with one reset instead of one free per node.
+ *
+ * @note This implementation is **not thread-safe**. It is designed for single-threaded use.
+ *       If you need to use it in a multithreaded context, external synchronization is required.
+ */
+
+#pragma once
+
+#include "dsa/common/allocator.h"
+#include "dsa/common/error_codes.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Opaque struct representing an arena.
+ */
+struct dsa_arena;
+
+/**
+ * @brief Handle to an arena.
+ */
+typedef struct dsa_arena* dsa_arena_t;
+
+/**
+ * @brief Options controlling `dsa_arena_create()`.
+ *
+ * A zero-initialized struct selects the defaults.
+ */
+typedef struct
+{
+    /**
+     * @brief Size of the chunks the arena obtains from the system, in bytes.
+     *        0 selects 64 KiB. Larger requests get a chunk of their own.
+     */
+    size_t chunk_size;
+
+    /**
+     * @brief If true, chunks are mapped with `mmap()` on Linux, rounded up to 2 MiB and
+     *        advised to use transparent huge pages, which reduces TLB misses for large
+     *        arenas. Ignored on other platforms.
+     */
+    bool huge_pages;
+} dsa_arena_options_t;
+
+/**
+ * @brief Position in an arena, captured by `dsa_arena_mark()`.
+ *
+ * Its fields are managed by the library and must not be modified by the user.
+ */
+typedef struct
+{
+    void* chunk;
+    size_t offset;
+} dsa_arena_mark_t;
+
+/**
+ * @brief Creates an empty arena. No memory is reserved until the first allocation.
+ *
+ * @param[out] handle Receives the handle of the new arena.
+ * @param[in] options Arena options, or NULL to use the defaults.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if @p handle is NULL,
+ *         or `DSA_ALLOC_FAILURE` if memory allocation fails.
+ */
+dsa_error_code_t dsa_arena_create(dsa_arena_t* handle, const dsa_arena_options_t* options);
+
+/**
+ * @brief Allocates @p size bytes aligned to @p alignment.
+ *
+ * This operation runs in constant time O(1), unless a new chunk must be obtained.
+ *
+ * @param[in] handle Arena handle.
+ * @param[in] size Number of bytes. Must be greater than 0.
+ * @param[in] alignment Required alignment, a power of two, or 0 for the alignment of `max_align_t`.
+ * @param[out] ptr Receives the address of the block.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` on bad arguments,
+ *         or `DSA_ALLOC_FAILURE` if a new chunk could not be obtained.
+ */
+dsa_error_code_t dsa_arena_alloc(dsa_arena_t handle, const size_t size, const size_t alignment, void** ptr);
+
+/**
+ * @brief Captures the current position of the arena.
+ *
+ * @param[in] handle Arena handle.
+ * @param[out] mark Receives the position.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if arguments are invalid.
+ */
+dsa_error_code_t dsa_arena_mark(dsa_arena_t handle, dsa_arena_mark_t* mark);
+
+/**
+ * @brief Releases every block allocated after @p mark was taken.
+ *
+ * This operation runs in constant time O(1). Marks taken after @p mark become invalid,
+ * while @p mark itself and earlier marks stay valid.
+ *
+ * @param[in] handle Arena handle.
+ * @param[in] mark Position captured by `dsa_arena_mark()` on the same arena.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if arguments are invalid.
+ */
+dsa_error_code_t dsa_arena_rewind(dsa_arena_t handle, const dsa_arena_mark_t* mark);
+
+/**
+ * @brief Releases every block of the arena, keeping its chunks for reuse.
+ *
+ * This operation runs in constant time O(1). All marks become invalid.
+ *
+ * @param[in] handle Arena handle.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if the handle is NULL.
+ */
+dsa_error_code_t dsa_arena_reset(dsa_arena_t handle);
+
+/**
+ * @brief Gets the number of bytes held by the arena's chunks.
+ *
+ * @param[in] handle Arena handle.
+ * @param[out] capacity Total size of all chunks, including the bookkeeping of each chunk.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if arguments are invalid.
+ */
+dsa_error_code_t dsa_arena_get_capacity(dsa_arena_t handle, size_t* capacity);
+
+/**
+ * @brief Builds an allocator that takes memory from the arena.
+ *
+ * Deallocation only reclaims the most recent block; other blocks are released by
+ * `dsa_arena_rewind()` or `dsa_arena_reset()`. Reallocation of the most recent block
+ * grows it in place when the chunk has room. Objects using the allocator must not be
+ * used after the memory they occupy has been rewound or reset; they may be abandoned
+ * without being destroyed.
+ *
+ * @param[in] handle Arena handle. Must outlive every use of the allocator.
+ * @param[out] allocator Receives the allocator.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if arguments are invalid.
+ */
+dsa_error_code_t dsa_arena_get_allocator(dsa_arena_t handle, dsa_allocator_t* allocator);
+
+/**
+ * @brief Destroys the arena and returns all of its chunks to the system.
+ *
+ * @param[in] handle Arena handle.
+ */
+void dsa_arena_destroy(dsa_arena_t handle);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
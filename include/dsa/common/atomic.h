@@ -0,0 +1,16 @@
+#pragma once
+
+/**
+ * @brief Declares an atomic object of the given type in a header shared by C and C++.
+ *
+ * C translation units use C11 `_Atomic`, C++ ones use `std::atomic`, which has the same
+ * size and representation on all supported compilers. Only the C side of the library
+ * operates on these objects; C++ code must treat them as opaque.
+ */
+#ifdef __cplusplus
+    #include <atomic>
+    #define DSA_ATOMIC(type) std::atomic<type>
+#else
+    #include <stdatomic.h>
+    #define DSA_ATOMIC(type) _Atomic(type)
+#endif
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <stddef.h>
+
+/**
+ * @brief Obtains a pointer to the enclosing structure from a pointer to one of its members.
+ *
+ * Used by the intrusive containers, whose link fields are embedded in user-defined structs.
+ *
+ * @param ptr Pointer to the member.
+ * @param type Type of the enclosing structure.
+ * @param member Name of the member within @p type.
+ */
+#define DSA_CONTAINER_OF(ptr, type, member) \
+    ((type*)(void*)((char*)(ptr) - offsetof(type, member)))
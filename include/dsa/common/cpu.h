@@ -0,0 +1,86 @@
+/**
+ * @file cpu.h
+ * @brief Runtime CPU feature detection used to dispatch to SIMD kernels.
+ *
+ * The instruction set level of the processor is detected once, on first use, and every
+ * kernel with SIMD variants binds to the best variant the level allows. A single binary
+ * built with the default compiler flags therefore runs the fastest kernels available on
+ * each machine. The level can be lowered, but never raised, with `dsa_cpu_force_level()`
+ * or the `DSA_CPU_LEVEL` environment variable, which lets tests run every variant.
+ */
+
+#pragma once
+
+#include "dsa/common/error_codes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Instruction set levels, each one implying all lower levels.
+ */
+typedef enum
+{
+    /**
+     * @brief Portable C only.
+     */
+    DSA_CPU_LEVEL_SCALAR = 0,
+
+    /**
+     * @brief x86 SSE2, the baseline of every x86-64 processor.
+     */
+    DSA_CPU_LEVEL_SSE2 = 1,
+
+    /**
+     * @brief x86 SSE4.2 (including SSSE3 and SSE4.1).
+     */
+    DSA_CPU_LEVEL_SSE4_2 = 2,
+
+    /**
+     * @brief x86 AVX2, with operating system support for the 256-bit registers.
+     */
+    DSA_CPU_LEVEL_AVX2 = 3,
+
+    /**
+     * @brief x86 AVX-512 F, BW and VL, with operating system support for the 512-bit registers.
+     */
+    DSA_CPU_LEVEL_AVX512 = 4,
+} dsa_cpu_level_t;
+
+/**
+ * @brief Returns the highest level supported by the processor and the operating system.
+ *
+ * Detection runs once; later calls return the cached result.
+ */
+dsa_cpu_level_t dsa_cpu_detect(void);
+
+/**
+ * @brief Returns the level the kernels currently dispatch on.
+ *
+ * This is the detected level, unless it was lowered by the `DSA_CPU_LEVEL` environment
+ * variable (one of `scalar`, `sse2`, `sse4.2`, `avx2` or `avx512`, read on first use)
+ * or by `dsa_cpu_force_level()`.
+ */
+dsa_cpu_level_t dsa_cpu_get_level(void);
+
+/**
+ * @brief Makes the kernels dispatch on @p level.
+ *
+ * Intended for tests and benchmarks that compare kernel variants. Takes effect for all
+ * threads on the next kernel call. Pass `dsa_cpu_detect()` to restore the best level.
+ *
+ * @param[in] level Level to use.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if @p level is not a valid level
+ *         or is not supported by this machine.
+ */
+dsa_error_code_t dsa_cpu_force_level(const dsa_cpu_level_t level);
+
+/**
+ * @brief Returns a short lowercase name of @p level, as accepted by `DSA_CPU_LEVEL`.
+ */
+const char* dsa_cpu_level_name(const dsa_cpu_level_t level);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
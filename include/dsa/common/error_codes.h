@@ -30,6 +30,11 @@ typedef enum
      * @brief Attempted an operation (e.g., pop, front) on an empty list.
      */
     DSA_EMPTY_LIST = 3,
+
+    /**
+     * @brief Attempted to insert into a bounded container that has no free capacity.
+     */
+    DSA_FULL = 4,
 } dsa_error_code_t;
 
 /**
@@ -0,0 +1,186 @@
+/**
+ * @file executor.h
+ * @brief Work-stealing thread pool shared by the parallel algorithms.
+ *
+ * Every worker thread owns a deque of tasks. A worker pushes the tasks it spawns to the
+ * back of its own deque and takes work from there first, which keeps recently touched data
+ * in its cache; once its deque is empty it steals the oldest task from another worker.
+ * Tasks are spawned into a task group, and waiting for the group executes pending tasks
+ * on the waiting thread instead of blocking it, so groups can be nested freely (fork/join).
+ *
+ * An executor created in "run on caller" mode owns no threads: every task runs on the thread
+ * that spawns it, at the moment it is spawned, which makes results reproducible in tests.
+ */
+
+#pragma once
+
+#include "dsa/common/atomic.h"
+#include "dsa/common/error_codes.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Opaque struct representing an executor.
+ */
+struct dsa_executor;
+
+/**
+ * @brief Handle to an executor.
+ */
+typedef struct dsa_executor* dsa_executor_t;
+
+/**
+ * @brief Options controlling `dsa_executor_create()`.
+ *
+ * A zero-initialized struct selects the defaults.
+ */
+typedef struct
+{
+    /**
+     * @brief Number of worker threads. 0 selects the number of processors.
+     *        Ignored in "run on caller" mode.
+     */
+    size_t num_threads;
+
+    /**
+     * @brief If true, worker `i` is pinned to processor `i` modulo the number of processors.
+     *        Pinning is silently skipped on platforms that do not support it.
+     */
+    bool pin_threads;
+
+    /**
+     * @brief If true, no threads are started and every task runs on the spawning thread.
+     */
+    bool run_on_caller;
+} dsa_executor_options_t;
+
+/**
+ * @brief Function executed as a task.
+ *
+ * @param arg User-provided argument passed to `dsa_task_group_run()`.
+ */
+typedef void (*dsa_task_func)(void* arg);
+
+/**
+ * @brief Function processing the half-open index range [@p begin, @p end).
+ *
+ * @param begin First index of the range.
+ * @param end One past the last index of the range.
+ * @param ctx User-provided context passed to `dsa_executor_parallel_for()`.
+ */
+typedef void (*dsa_range_func)(size_t begin, size_t end, void* ctx);
+
+/**
+ * @brief Set of tasks that can be waited for together.
+ *
+ * Unlike the executor this is not an opaque handle: it is usually placed on the stack of the
+ * thread that spawns the tasks, and must be initialized with `dsa_task_group_init()`.
+ * Fields should only be accessed through the functions below.
+ */
+typedef struct
+{
+    dsa_executor_t executor;
+    DSA_ATOMIC(size_t) pending;
+} dsa_task_group_t;
+
+/**
+ * @brief Creates an executor and starts its worker threads.
+ *
+ * @param[out] handle Receives the handle of the new executor.
+ * @param[in] options Executor options, or NULL to use the defaults.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if @p handle is NULL,
+ *         or `DSA_ALLOC_FAILURE` if memory allocation or thread creation fails.
+ */
+dsa_error_code_t dsa_executor_create(dsa_executor_t* handle, const dsa_executor_options_t* options);
+
+/**
+ * @brief Retrieves the process-wide executor used when no executor is given explicitly.
+ *
+ * The executor is created with default options on first use and lives until the process exits.
+ *
+ * @param[out] handle Receives the handle of the default executor. It must not be destroyed.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if @p handle is NULL,
+ *         or `DSA_ALLOC_FAILURE` if the executor could not be created.
+ */
+dsa_error_code_t dsa_executor_get_default(dsa_executor_t* handle);
+
+/**
+ * @brief Gets the number of worker threads of an executor.
+ *
+ * @param[in] handle Executor handle.
+ * @param[out] num_threads Number of worker threads, 0 in "run on caller" mode.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if arguments are invalid.
+ */
+dsa_error_code_t dsa_executor_get_thread_count(dsa_executor_t handle, size_t* num_threads);
+
+/**
+ * @brief Runs @p body over [0, @p count), split into ranges processed in parallel.
+ *
+ * The range is halved recursively, spawning one half as a task and keeping the other, until
+ * the pieces hold at most @p grain indices. Idle workers steal the largest pending halves,
+ * which balances uneven work automatically. The calling thread takes part in the work, and
+ * the function returns once @p body has been called for every index. In "run on caller" mode
+ * the pieces are processed in ascending order.
+ *
+ * @param[in] handle Executor handle, or NULL to use the default executor.
+ * @param[in] count Number of indices.
+ * @param[in] grain Largest number of indices passed to a single call of @p body.
+ *                  0 selects a size giving every worker several pieces.
+ * @param[in] body Function processing a range. It is called concurrently on disjoint ranges.
+ * @param[in] ctx User-provided context passed to @p body. May be NULL.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if @p count is zero or @p body is NULL,
+ *         or `DSA_ALLOC_FAILURE` if the default executor could not be created.
+ */
+dsa_error_code_t dsa_executor_parallel_for(dsa_executor_t handle, const size_t count, const size_t grain, dsa_range_func body,
+                                           void* ctx);
+
+/**
+ * @brief Destroys an executor, stopping and joining its worker threads.
+ *
+ * All task groups of the executor must have been waited for.
+ *
+ * @param[in] handle Executor handle.
+ */
+void dsa_executor_destroy(dsa_executor_t handle);
+
+/**
+ * @brief Initializes an empty task group bound to an executor.
+ *
+ * @param[out] group Group to initialize.
+ * @param[in] executor Executor running the group's tasks.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if arguments are invalid.
+ */
+dsa_error_code_t dsa_task_group_init(dsa_task_group_t* group, dsa_executor_t executor);
+
+/**
+ * @brief Spawns @p func as a task of the group.
+ *
+ * Tasks may spawn further tasks, into the same group or into nested ones. If the task
+ * bookkeeping cannot be allocated, @p func runs immediately on the calling thread instead.
+ *
+ * @param[in] group Group the task belongs to.
+ * @param[in] func Function to run.
+ * @param[in] arg Argument passed to @p func. May be NULL.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if @p group or @p func is NULL.
+ */
+dsa_error_code_t dsa_task_group_run(dsa_task_group_t* group, dsa_task_func func, void* arg);
+
+/**
+ * @brief Waits until every task spawned into the group has finished.
+ *
+ * While waiting, the calling thread executes pending tasks of the executor. Afterwards the
+ * group is empty and can be reused.
+ *
+ * @param[in] group Group to wait for.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if @p group is NULL.
+ */
+dsa_error_code_t dsa_task_group_wait(dsa_task_group_t* group);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -0,0 +1,98 @@
+/**
+ * @file stats.h
+ * @brief Optional per-thread operation counters for tuning comparators and algorithm choices.
+ *
+ * When the library is built with `DSA_ENABLE_STATS`, the sorting and searching algorithms
+ * count the comparison callbacks they make and the elements they move, the singly linked
+ * list counts the predicate callbacks of `dsa_slist_remove_if()`, and `dsa_allocate()`,
+ * `dsa_reallocate()` and `dsa_deallocate()` count the memory they hand out, so allocations
+ * of every container using an allocator are included. Without the option the counting
+ * code is not compiled at all; the functions below still exist and report zeros.
+ *
+ * Counters are kept per thread and are only ever updated by the thread doing the work:
+ * a snapshot covers the operations performed on the calling thread since its last reset.
+ */
+
+#pragma once
+
+#include "dsa/common/error_codes.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Counter values of one thread.
+ */
+typedef struct
+{
+    /**
+     * @brief Calls of comparison or predicate callbacks.
+     */
+    uint64_t comparisons;
+
+    /**
+     * @brief Elements copied from one place to another, including to and from temporaries.
+     */
+    uint64_t moves;
+
+    /**
+     * @brief Successful allocations, including reallocations.
+     */
+    uint64_t allocations;
+
+    /**
+     * @brief Bytes requested by the successful allocations.
+     */
+    uint64_t allocated_bytes;
+
+    /**
+     * @brief Blocks returned to an allocator.
+     */
+    uint64_t deallocations;
+} dsa_stats_t;
+
+/**
+ * @brief Checks whether the library was built with `DSA_ENABLE_STATS`.
+ *
+ * @return true if the counters are maintained, false if they always read zero.
+ */
+bool dsa_stats_enabled(void);
+
+/**
+ * @brief Copies the counters of the calling thread.
+ *
+ * @param[out] stats Receives the counter values.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if @p stats is NULL.
+ */
+dsa_error_code_t dsa_stats_snapshot(dsa_stats_t* stats);
+
+/**
+ * @brief Sets all counters of the calling thread to zero.
+ */
+void dsa_stats_reset(void);
+
+// The library's own sources update the counters through the macros below, which compile to
+// nothing unless DSA_ENABLE_STATS is defined for the library build.
+#if defined(DSA_ENABLE_STATS) && !defined(__cplusplus)
+
+    #if defined(_MSC_VER)
+extern __declspec(thread) dsa_stats_t dsa_stats_thread_counters;
+    #else
+extern _Thread_local dsa_stats_t dsa_stats_thread_counters;
+    #endif
+
+    #define DSA_STATS_ADD(counter, amount) (dsa_stats_thread_counters.counter += (uint64_t)(amount))
+
+#else
+
+    #define DSA_STATS_ADD(counter, amount) ((void)0)
+
+#endif
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
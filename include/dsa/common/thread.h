@@ -0,0 +1,156 @@
+/**
+ * @file thread.h
+ * @brief Minimal portable thread interface used by the parallel algorithms.
+ *
+ * Wraps POSIX threads or the Win32 thread API, so that the rest of the library does
+ * not depend on platform headers.
+ */
+
+#pragma once
+
+#include "dsa/common/error_codes.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Opaque struct representing a running thread.
+ */
+struct dsa_thread;
+
+/**
+ * @brief Handle to a thread.
+ */
+typedef struct dsa_thread* dsa_thread_t;
+
+/**
+ * @brief Function executed by a thread.
+ *
+ * @param arg User-provided argument passed to `dsa_thread_create()`.
+ */
+typedef void (*dsa_thread_func)(void* arg);
+
+/**
+ * @brief Starts a new thread running @p func.
+ *
+ * Every successfully created thread must be joined with `dsa_thread_join()`.
+ *
+ * @param[out] handle Receives the handle of the new thread.
+ * @param[in] func Function to run.
+ * @param[in] arg Argument passed to @p func. May be NULL.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if @p handle or @p func is NULL,
+ *         or `DSA_ALLOC_FAILURE` if the thread could not be created.
+ */
+dsa_error_code_t dsa_thread_create(dsa_thread_t* handle, dsa_thread_func func, void* arg);
+
+/**
+ * @brief Waits for a thread to finish and releases its handle.
+ *
+ * @param[in] handle Thread handle. Invalid after this call.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if the handle is NULL.
+ */
+dsa_error_code_t dsa_thread_join(dsa_thread_t handle);
+
+/**
+ * @brief Returns the number of processors available to the process, at least 1.
+ */
+size_t dsa_thread_hardware_concurrency(void);
+
+/**
+ * @brief Gives up the rest of the calling thread's time slice.
+ */
+void dsa_thread_yield(void);
+
+/**
+ * @brief Restricts the calling thread to run only on processor @p cpu.
+ *
+ * Supported on Linux and Windows. Elsewhere the call has no effect.
+ *
+ * @param[in] cpu Zero-based processor index. Taken modulo the number of processors.
+ * @return `DSA_SUCCESS` on success or if pinning is not supported,
+ *         `DSA_INVALID_INPUT` if the operating system rejected the request.
+ */
+dsa_error_code_t dsa_thread_pin_current(const size_t cpu);
+
+/**
+ * @brief Opaque struct representing a mutual exclusion lock.
+ */
+struct dsa_mutex;
+
+/**
+ * @brief Handle to a mutex.
+ */
+typedef struct dsa_mutex* dsa_mutex_t;
+
+/**
+ * @brief Creates an unlocked, non-recursive mutex.
+ *
+ * @param[out] handle Receives the handle of the new mutex.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if @p handle is NULL,
+ *         or `DSA_ALLOC_FAILURE` if the mutex could not be created.
+ */
+dsa_error_code_t dsa_mutex_create(dsa_mutex_t* handle);
+
+/**
+ * @brief Locks a mutex, blocking until it becomes available.
+ */
+void dsa_mutex_lock(dsa_mutex_t handle);
+
+/**
+ * @brief Unlocks a mutex held by the calling thread.
+ */
+void dsa_mutex_unlock(dsa_mutex_t handle);
+
+/**
+ * @brief Destroys an unlocked mutex.
+ */
+void dsa_mutex_destroy(dsa_mutex_t handle);
+
+/**
+ * @brief Opaque struct representing a condition variable.
+ */
+struct dsa_cond;
+
+/**
+ * @brief Handle to a condition variable.
+ */
+typedef struct dsa_cond* dsa_cond_t;
+
+/**
+ * @brief Creates a condition variable.
+ *
+ * @param[out] handle Receives the handle of the new condition variable.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if @p handle is NULL,
+ *         or `DSA_ALLOC_FAILURE` if the condition variable could not be created.
+ */
+dsa_error_code_t dsa_cond_create(dsa_cond_t* handle);
+
+/**
+ * @brief Atomically unlocks @p mutex and waits until the condition variable is signaled.
+ *
+ * The mutex is locked again before the function returns. Spurious wakeups are possible,
+ * so the awaited condition must be checked in a loop.
+ */
+void dsa_cond_wait(dsa_cond_t handle, dsa_mutex_t mutex);
+
+/**
+ * @brief Wakes up one thread waiting on the condition variable.
+ */
+void dsa_cond_signal(dsa_cond_t handle);
+
+/**
+ * @brief Wakes up all threads waiting on the condition variable.
+ */
+void dsa_cond_broadcast(dsa_cond_t handle);
+
+/**
+ * @brief Destroys a condition variable no thread is waiting on.
+ */
+void dsa_cond_destroy(dsa_cond_t handle);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
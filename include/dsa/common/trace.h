@@ -0,0 +1,152 @@
+/**
+ * @file trace.h
+ * @brief Optional tracing of hot-path calls through USDT probes and a callback hook.
+ *
+ * When the library is built with `DSA_ENABLE_TRACING`, the sorting and searching algorithms,
+ * the push and pop operations of the singly linked list and the numeric solvers mark their
+ * entry and exit. Every point carries the number of elements and the element size:
+ *
+ * - On platforms providing `<sys/sdt.h>` each point is a USDT probe of the `dsa` provider,
+ *   named after the function and the phase, e.g. `dsa:insertion_sort_entry`. A probe is a
+ *   single no-op instruction until a tool such as perf or bpftrace attaches to it.
+ * - The hook set with `dsa_trace_set_hook()` is called at every point, which allows the
+ *   application itself to build per-call latency histograms.
+ *
+ * Without the option the tracing code is not compiled at all; the functions below still
+ * exist, but the hook is never called.
+ */
+
+#pragma once
+
+#include "dsa/common/error_codes.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Position of a trace point within the traced call.
+ */
+typedef enum
+{
+    /**
+     * @brief The call has started and its arguments were validated.
+     */
+    DSA_TRACE_PHASE_ENTRY = 0,
+
+    /**
+     * @brief The call is about to return.
+     */
+    DSA_TRACE_PHASE_EXIT = 1,
+} dsa_trace_phase_t;
+
+/**
+ * @brief Data passed to the trace hook.
+ */
+typedef struct
+{
+    /**
+     * @brief Name of the traced operation, identical to the USDT probe name without the phase.
+     */
+    const char* probe;
+
+    /**
+     * @brief Entry or exit.
+     */
+    dsa_trace_phase_t phase;
+
+    /**
+     * @brief Number of elements the operation works on. For containers, the container size.
+     */
+    size_t size;
+
+    /**
+     * @brief Size in bytes of one element.
+     */
+    size_t elem_size;
+} dsa_trace_event_t;
+
+/**
+ * @brief Function called at every trace point.
+ *
+ * It runs on the thread making the traced call and must not call traced functions itself.
+ *
+ * @param event Description of the trace point.
+ * @param ctx User-provided context passed to `dsa_trace_set_hook()`.
+ */
+typedef void (*dsa_trace_hook)(const dsa_trace_event_t* event, void* ctx);
+
+/**
+ * @brief Checks whether the library was built with `DSA_ENABLE_TRACING`.
+ *
+ * @return true if the trace points are compiled in, false otherwise.
+ */
+bool dsa_trace_enabled(void);
+
+/**
+ * @brief Installs the process-wide trace hook, replacing the previous one.
+ *
+ * The hook and its context are not replaced atomically as a pair, so the hook should be
+ * changed while no traced calls are running.
+ *
+ * @param[in] hook Function to call at every trace point, or NULL to remove the hook.
+ * @param[in] ctx User-provided context passed to @p hook. May be NULL.
+ * @return `DSA_SUCCESS`.
+ */
+dsa_error_code_t dsa_trace_set_hook(dsa_trace_hook hook, void* ctx);
+
+/**
+ * @brief Calls the installed hook, if any. Used by the trace points of the library.
+ *
+ * @param[in] probe Name of the traced operation.
+ * @param[in] phase Entry or exit.
+ * @param[in] size Number of elements.
+ * @param[in] elem_size Size in bytes of one element.
+ */
+void dsa_trace_emit(const char* probe, const dsa_trace_phase_t phase, const size_t size, const size_t elem_size);
+
+// The library's own sources mark trace points with the macros below, which compile to
+// nothing unless DSA_ENABLE_TRACING is defined for the library build.
+#if defined(DSA_ENABLE_TRACING) && !defined(__cplusplus)
+
+    #include <stdatomic.h>
+
+    #if defined(__has_include)
+        #if __has_include(<sys/sdt.h>)
+            #include <sys/sdt.h>
+            #define DSA_TRACE_USDT_(probe, phase, size, elem_size) DTRACE_PROBE2(dsa, probe##_##phase, size, elem_size)
+        #endif
+    #endif
+
+    #if !defined(DSA_TRACE_USDT_)
+        #define DSA_TRACE_USDT_(probe, phase, size, elem_size) ((void)0)
+    #endif
+
+extern _Atomic(dsa_trace_hook) dsa_trace_active_hook;
+
+    #define DSA_TRACE_POINT_(probe, phase, phase_value, size, elem_size)                                       \
+        do                                                                                                     \
+        {                                                                                                      \
+            DSA_TRACE_USDT_(probe, phase, size, elem_size);                                                    \
+            if (atomic_load_explicit(&dsa_trace_active_hook, memory_order_relaxed))                            \
+            {                                                                                                  \
+                dsa_trace_emit(#probe, phase_value, size, elem_size);                                          \
+            }                                                                                                  \
+        } while (0)
+
+    #define DSA_TRACE_ENTRY(probe, size, elem_size) DSA_TRACE_POINT_(probe, entry, DSA_TRACE_PHASE_ENTRY, size, elem_size)
+    #define DSA_TRACE_EXIT(probe, size, elem_size) DSA_TRACE_POINT_(probe, exit, DSA_TRACE_PHASE_EXIT, size, elem_size)
+
+#else
+
+    #define DSA_TRACE_ENTRY(probe, size, elem_size) ((void)0)
+    #define DSA_TRACE_EXIT(probe, size, elem_size) ((void)0)
+
+#endif
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
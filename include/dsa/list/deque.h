@@ -0,0 +1,195 @@
+/**
+ * @file deque.h
+ * @brief Double-ended queue backed by a growable ring buffer, using an opaque handle.
+ *
+ * Elements are stored contiguously in a circular array, so the deque avoids the per-node
+ * allocation and pointer chasing of @ref slist_t while keeping a compatible interface:
+ * the same data-pointer elements, the same destroy callback semantics, and functions
+ * named after their slist counterparts. The buffer doubles when full, which gives O(1)
+ * amortized insertion at both ends, and supports O(1) indexed access.
+ *
+ * @note This implementation is **not thread-safe**. It is designed for single-threaded use.
+ *       If you need to use it in a multithreaded context, external synchronization is required.
+ */
+
+#pragma once
+
+#include "dsa/common/allocator.h"
+#include "dsa/common/error_codes.h"
+#include "dsa/list/slist.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Opaque struct representing a deque.
+ */
+struct deque;
+
+/**
+ * @brief Handle to a deque.
+ */
+typedef struct deque* deque_t;
+
+/**
+ * @brief Creates a new, empty deque.
+ *
+ * No element storage is allocated until the first insertion or `dsa_deque_reserve()`.
+ *
+ * @param[out] handle Pointer to a handle that will point to the created deque.
+ * @param[in] func Optional destructor function for elements. Pass NULL if not needed.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if @p handle is NULL,
+ *         or `DSA_ALLOC_FAILURE` if memory allocation fails.
+ */
+dsa_error_code_t dsa_deque_create(deque_t* handle, slist_destroy_element_func func);
+
+/**
+ * @brief Creates a new, empty deque that obtains its memory from @p allocator.
+ *
+ * The allocator is copied into the deque and used for the deque itself and its element storage.
+ *
+ * @param[out] handle Pointer to a handle that will point to the created deque.
+ * @param[in] func Optional destructor function for elements. Pass NULL if not needed.
+ * @param[in] allocator Allocator to use, or NULL for the current default allocator.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if @p handle is NULL or @p allocator
+ *         lacks a required callback, or `DSA_ALLOC_FAILURE` if memory allocation fails.
+ */
+dsa_error_code_t dsa_deque_create_with_allocator(deque_t* handle, slist_destroy_element_func func, const dsa_allocator_t* allocator);
+
+/**
+ * @brief Ensures the deque can hold at least @p capacity elements without reallocating.
+ *
+ * @param[in] handle Deque handle.
+ * @param[in] capacity Requested capacity. Rounded up to a power of two.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` on bad arguments,
+ *         or `DSA_ALLOC_FAILURE` if memory allocation fails.
+ */
+dsa_error_code_t dsa_deque_reserve(deque_t handle, const size_t capacity);
+
+/**
+ * @brief Retrieves the element at the front of the deque.
+ *
+ * @param[in] handle Deque handle.
+ * @param[out] head Pointer to the front element. Set to NULL if the deque is empty.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if arguments are invalid.
+ */
+dsa_error_code_t dsa_deque_get_head(deque_t handle, void** head);
+
+/**
+ * @brief Retrieves the element at the back of the deque.
+ *
+ * @param[in] handle Deque handle.
+ * @param[out] tail Pointer to the back element. Set to NULL if the deque is empty.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if arguments are invalid.
+ */
+dsa_error_code_t dsa_deque_get_tail(deque_t handle, void** tail);
+
+/**
+ * @brief Retrieves the element at the given position, counted from the front.
+ *
+ * This operation runs in constant time O(1).
+ *
+ * @param[in] handle Deque handle.
+ * @param[in] index Position of the element. Must be smaller than the deque size.
+ * @param[out] data Pointer to the element.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if arguments are invalid
+ *         or @p index is out of range.
+ */
+dsa_error_code_t dsa_deque_get_at(deque_t handle, const size_t index, void** data);
+
+/**
+ * @brief Gets the number of elements in the deque.
+ *
+ * This operation runs in constant time O(1).
+ *
+ * @param[in] handle Deque handle.
+ * @param[out] size Pointer to the variable that will receive the deque size.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` on bad arguments.
+ */
+dsa_error_code_t dsa_deque_get_size(const deque_t handle, size_t* size);
+
+/**
+ * @brief Checks whether the deque is empty.
+ *
+ * This operation runs in constant time O(1).
+ *
+ * @param[in] handle Deque handle.
+ * @param[out] is_empty Set to true if the deque is empty, false otherwise.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if arguments are invalid.
+ */
+dsa_error_code_t dsa_deque_is_empty(deque_t handle, bool* is_empty);
+
+/**
+ * @brief Inserts a new element at the front of the deque.
+ *
+ * This operation runs in amortized constant time O(1).
+ *
+ * @param[in] handle Deque handle.
+ * @param[in] data Pointer to the data to insert. Must not be NULL.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` on bad arguments,
+ *         or `DSA_ALLOC_FAILURE` if the buffer cannot grow.
+ */
+dsa_error_code_t dsa_deque_push_front(deque_t handle, void* data);
+
+/**
+ * @brief Inserts a new element at the back of the deque.
+ *
+ * This operation runs in amortized constant time O(1).
+ *
+ * @param[in] handle Deque handle.
+ * @param[in] data Pointer to the data to insert. Must not be NULL.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` on bad arguments,
+ *         or `DSA_ALLOC_FAILURE` if the buffer cannot grow.
+ */
+dsa_error_code_t dsa_deque_push_back(deque_t handle, void* data);
+
+/**
+ * @brief Removes the element at the front of the deque.
+ *
+ * This operation runs in constant time O(1).
+ * If a destroy function was provided at creation, it is called on the removed element.
+ *
+ * @param[in] handle Deque handle.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` on bad arguments,
+ *         or `DSA_EMPTY_LIST` if the deque is empty.
+ */
+dsa_error_code_t dsa_deque_pop_front(deque_t handle);
+
+/**
+ * @brief Removes the element at the back of the deque.
+ *
+ * This operation runs in constant time O(1).
+ * If a destroy function was provided at creation, it is called on the removed element.
+ *
+ * @param[in] handle Deque handle.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` on bad arguments,
+ *         or `DSA_EMPTY_LIST` if the deque is empty.
+ */
+dsa_error_code_t dsa_deque_pop_back(deque_t handle);
+
+/**
+ * @brief Removes all elements, calling the destroy function if set.
+ *
+ * This operation runs in linear time O(n). The buffer is kept for reuse.
+ *
+ * @param[in] handle Deque handle.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if the handle is NULL.
+ */
+dsa_error_code_t dsa_deque_clear(deque_t handle);
+
+/**
+ * @brief Destroys the deque and frees its memory.
+ *
+ * If a destroy function was provided at creation, it will be called for each element.
+ *
+ * @param[in] handle Deque handle to destroy. Safe to call with NULL.
+ */
+void dsa_deque_destroy(deque_t handle);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
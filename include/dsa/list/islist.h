@@ -0,0 +1,203 @@
+/**
+ * @file islist.h
+ * @brief Intrusive singly linked list interface.
+ *
+ * The link field (@ref islist_link_t) is embedded in the user's own struct and the
+ * enclosing object is recovered with @ref DSA_CONTAINER_OF. The list never allocates
+ * or frees memory, so no operation can fail with `DSA_ALLOC_FAILURE`. Ownership of the
+ * linked objects stays with the caller.
+ *
+ * @note This implementation is **not thread-safe**. It is designed for single-threaded use.
+ *       If you need to use it in a multithreaded context, external synchronization is required.
+ */
+
+#pragma once
+
+#include "dsa/common/container_of.h"
+#include "dsa/common/error_codes.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Link field embedded in objects stored in an intrusive list.
+ *
+ * A link may belong to at most one list at a time.
+ */
+typedef struct islist_link
+{
+    struct islist_link* next;
+} islist_link_t;
+
+/**
+ * @brief Intrusive singly linked list.
+ *
+ * Unlike @ref slist_t this is not an opaque handle: it is usually embedded in another
+ * struct or placed on the stack, and must be initialized with `dsa_islist_init()`.
+ * Fields should only be modified through the functions below.
+ */
+typedef struct
+{
+    islist_link_t* head;
+    islist_link_t* tail;
+    size_t size;
+} islist_t;
+
+/**
+ * @brief Iterates over all links of an intrusive list, from head to tail.
+ *
+ * The list must not be modified inside the loop body.
+ *
+ * @param pos `islist_link_t*` loop variable.
+ * @param list Pointer to the list to iterate over.
+ */
+#define DSA_ISLIST_FOR_EACH(pos, list) \
+    for ((pos) = (list)->head; (pos); (pos) = (pos)->next)
+
+/**
+ * @brief Initializes an empty intrusive list.
+ *
+ * @param[out] list List to initialize.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if @p list is NULL.
+ */
+dsa_error_code_t dsa_islist_init(islist_t* list);
+
+/**
+ * @brief Retrieves the head link of the list.
+ *
+ * @param[in] list List to query.
+ * @param[out] head Pointer to the head link. Set to NULL if the list is empty.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if arguments are invalid.
+ */
+dsa_error_code_t dsa_islist_get_head(const islist_t* list, islist_link_t** head);
+
+/**
+ * @brief Retrieves the tail link of the list.
+ *
+ * @param[in] list List to query.
+ * @param[out] tail Pointer to the tail link. Set to NULL if the list is empty.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if arguments are invalid.
+ */
+dsa_error_code_t dsa_islist_get_tail(const islist_t* list, islist_link_t** tail);
+
+/**
+ * @brief Gets the number of links in the list.
+ *
+ * This operation runs in constant time O(1).
+ *
+ * @param[in] list List to query.
+ * @param[out] size Pointer to the variable that will receive the list size.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` on bad arguments.
+ */
+dsa_error_code_t dsa_islist_get_size(const islist_t* list, size_t* size);
+
+/**
+ * @brief Checks whether the list is empty.
+ *
+ * This operation runs in constant time O(1).
+ *
+ * @param[in] list List to query.
+ * @param[out] is_empty Set to true if the list is empty, false otherwise.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if arguments are invalid.
+ */
+dsa_error_code_t dsa_islist_is_empty(const islist_t* list, bool* is_empty);
+
+/**
+ * @brief Links @p link at the front of the list.
+ *
+ * This operation runs in constant time O(1).
+ *
+ * @param[in] list List to modify.
+ * @param[in] link Link to insert. Must not currently belong to any list.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` on bad arguments.
+ */
+dsa_error_code_t dsa_islist_push_front(islist_t* list, islist_link_t* link);
+
+/**
+ * @brief Links @p link at the back of the list.
+ *
+ * This operation runs in constant time O(1).
+ *
+ * @param[in] list List to modify.
+ * @param[in] link Link to insert. Must not currently belong to any list.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` on bad arguments.
+ */
+dsa_error_code_t dsa_islist_push_back(islist_t* list, islist_link_t* link);
+
+/**
+ * @brief Unlinks the link at the front of the list.
+ *
+ * This operation runs in constant time O(1).
+ *
+ * @param[in] list List to modify.
+ * @param[out] link Receives the unlinked link. May be NULL if the caller does not need it.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` on bad arguments,
+ *         or `DSA_EMPTY_LIST` if the list is empty.
+ */
+dsa_error_code_t dsa_islist_pop_front(islist_t* list, islist_link_t** link);
+
+/**
+ * @brief Unlinks the link at the back of the list.
+ *
+ * This operation runs in linear time O(n), since the list must be traversed to find the second-last link.
+ *
+ * @param[in] list List to modify.
+ * @param[out] link Receives the unlinked link. May be NULL if the caller does not need it.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` on bad arguments,
+ *         or `DSA_EMPTY_LIST` if the list is empty.
+ */
+dsa_error_code_t dsa_islist_pop_back(islist_t* list, islist_link_t** link);
+
+/**
+ * @brief Unlinks the link that follows @p prev.
+ *
+ * This operation runs in constant time O(1). It allows removing elements while
+ * traversing the list, keeping track of the previous link.
+ *
+ * @param[in] list List to modify.
+ * @param[in] prev Link preceding the one to remove, or NULL to remove the head.
+ * @param[out] link Receives the unlinked link. May be NULL if the caller does not need it.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` on bad arguments or if @p prev
+ *         is the tail, or `DSA_EMPTY_LIST` if the list is empty.
+ */
+dsa_error_code_t dsa_islist_remove_after(islist_t* list, islist_link_t* prev, islist_link_t** link);
+
+/**
+ * @brief Moves all links of @p other to the back of @p list.
+ *
+ * This operation runs in constant time O(1). After this call @p other is empty.
+ *
+ * @param[in] list Destination list.
+ * @param[in] other Source list. Must be distinct from @p list.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` on bad arguments.
+ */
+dsa_error_code_t dsa_islist_splice(islist_t* list, islist_t* other);
+
+/**
+ * @brief Unlinks all elements from the list.
+ *
+ * This operation runs in constant time O(1). The links themselves are not touched,
+ * since their storage is owned by the caller.
+ *
+ * @param[in] list List to clear.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if @p list is NULL.
+ */
+dsa_error_code_t dsa_islist_clear(islist_t* list);
+
+/**
+ * @brief Reverses the order of links in the list.
+ *
+ * This operation runs in linear time O(n) and modifies the list in place.
+ *
+ * @param[in] list List to reverse.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if @p list is NULL.
+ */
+dsa_error_code_t dsa_islist_reverse(islist_t* list);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
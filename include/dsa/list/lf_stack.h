@@ -0,0 +1,97 @@
+/**
+ * @file lf_stack.h
+ * @brief Lock-free LIFO stack (Treiber stack) using an opaque handle.
+ *
+ * Any number of threads may push and pop concurrently without locks. Elements are
+ * stored in nodes with the same layout as singly linked list nodes (data pointer plus
+ * link), taken from a pool owned by the stack. Popped nodes are recycled instead of freed,
+ * so a thread that lost a race never touches released memory. Each update of the stack
+ * top also bumps a version tag, which protects against the ABA problem.
+ *
+ * @note Only `dsa_lf_stack_create()` and `dsa_lf_stack_destroy()` are not thread-safe;
+ *       all other functions may be called concurrently.
+ */
+
+#pragma once
+
+#include "dsa/common/error_codes.h"
+#include "dsa/list/slist.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Opaque struct representing a lock-free stack.
+ */
+struct lf_stack;
+
+/**
+ * @brief Handle to a lock-free stack.
+ */
+typedef struct lf_stack* lf_stack_t;
+
+/**
+ * @brief Creates a new lock-free stack.
+ *
+ * @param[out] handle Pointer to a handle that will point to the created stack.
+ * @param[in] func Optional destructor called for elements still on the stack when it is destroyed.
+ *                 Pass NULL if not needed.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if @p handle is NULL,
+ *         or `DSA_ALLOC_FAILURE` if memory allocation fails.
+ */
+dsa_error_code_t dsa_lf_stack_create(lf_stack_t* handle, slist_destroy_element_func func);
+
+/**
+ * @brief Pushes an element on top of the stack.
+ *
+ * This operation is lock-free. It allocates only when every node allocated so far is in use;
+ * the node pool grows geometrically, up to about 2^32 nodes.
+ *
+ * @param[in] handle Stack handle.
+ * @param[in] data Pointer to the data to insert. Must not be NULL.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` on bad arguments,
+ *         or `DSA_ALLOC_FAILURE` if the node pool cannot grow.
+ */
+dsa_error_code_t dsa_lf_stack_push(lf_stack_t handle, void* data);
+
+/**
+ * @brief Pops the element on top of the stack.
+ *
+ * This operation is lock-free and never allocates. Ownership of the element passes to the caller,
+ * so the destroy function is not called.
+ *
+ * @param[in] handle Stack handle.
+ * @param[out] data Receives the popped element.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` on bad arguments,
+ *         or `DSA_EMPTY_LIST` if the stack is empty.
+ */
+dsa_error_code_t dsa_lf_stack_pop(lf_stack_t handle, void** data);
+
+/**
+ * @brief Checks whether the stack is empty.
+ *
+ * Under concurrent modification the result is only a snapshot.
+ *
+ * @param[in] handle Stack handle.
+ * @param[out] is_empty Set to true if the stack is empty, false otherwise.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if arguments are invalid.
+ */
+dsa_error_code_t dsa_lf_stack_is_empty(lf_stack_t handle, bool* is_empty);
+
+/**
+ * @brief Destroys the stack and its node pool.
+ *
+ * If a destroy function was provided at creation, it is called for each remaining element.
+ * No other thread may access the stack during or after this call.
+ *
+ * @param[in] handle Stack handle to destroy. Safe to call with NULL.
+ */
+void dsa_lf_stack_destroy(lf_stack_t handle);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
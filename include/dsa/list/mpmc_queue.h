@@ -0,0 +1,147 @@
+/**
+ * @file mpmc_queue.h
+ * @brief Bounded lock-free multi-producer multi-consumer FIFO queue using an opaque handle.
+ *
+ * The queue is a ring buffer following Dmitry Vyukov's bounded MPMC algorithm: every slot
+ * carries a sequence number that tells producers and consumers whether it is ready for them,
+ * so each push or pop costs a single compare-and-swap on an uncontended cursor. The producer
+ * and consumer cursors live on separate cache lines to avoid false sharing.
+ *
+ * All storage is allocated at creation; pushing and popping never allocate.
+ *
+ * @note Only `dsa_mpmc_queue_create()` and `dsa_mpmc_queue_destroy()` are not thread-safe;
+ *       all other functions may be called concurrently from any number of threads.
+ */
+
+#pragma once
+
+#include "dsa/common/error_codes.h"
+#include "dsa/list/slist.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Opaque struct representing a bounded MPMC queue.
+ */
+struct mpmc_queue;
+
+/**
+ * @brief Handle to a bounded MPMC queue.
+ */
+typedef struct mpmc_queue* mpmc_queue_t;
+
+/**
+ * @brief Creates a new bounded MPMC queue.
+ *
+ * @param[out] handle Pointer to a handle that will point to the created queue.
+ * @param[in] capacity Minimum number of elements the queue can hold. Rounded up to a power of two.
+ *                     Must be greater than 0.
+ * @param[in] func Optional destructor called for elements still queued when the queue is destroyed.
+ *                 Pass NULL if not needed.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` on bad arguments,
+ *         or `DSA_ALLOC_FAILURE` if memory allocation fails.
+ */
+dsa_error_code_t dsa_mpmc_queue_create(mpmc_queue_t* handle, const size_t capacity, slist_destroy_element_func func);
+
+/**
+ * @brief Gets the number of elements the queue can hold.
+ *
+ * @param[in] handle Queue handle.
+ * @param[out] capacity Receives the capacity, after rounding up to a power of two.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if arguments are invalid.
+ */
+dsa_error_code_t dsa_mpmc_queue_get_capacity(mpmc_queue_t handle, size_t* capacity);
+
+/**
+ * @brief Appends an element at the back of the queue if there is room for it.
+ *
+ * This operation is lock-free.
+ *
+ * @param[in] handle Queue handle.
+ * @param[in] data Pointer to the data to insert. Must not be NULL.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` on bad arguments,
+ *         or `DSA_FULL` if the queue is full.
+ */
+dsa_error_code_t dsa_mpmc_queue_try_push(mpmc_queue_t handle, void* data);
+
+/**
+ * @brief Appends an element at the back of the queue, waiting until there is room for it.
+ *
+ * The calling thread spins and then yields while the queue is full.
+ *
+ * @param[in] handle Queue handle.
+ * @param[in] data Pointer to the data to insert. Must not be NULL.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` on bad arguments.
+ */
+dsa_error_code_t dsa_mpmc_queue_push(mpmc_queue_t handle, void* data);
+
+/**
+ * @brief Appends up to @p count elements at the back of the queue, preserving their order.
+ *
+ * Consecutive free slots are claimed with a single compare-and-swap, so a batch costs about
+ * as much synchronization as a single push. Elements that do not fit are not inserted.
+ *
+ * @param[in] handle Queue handle.
+ * @param[in] data Array of @p count pointers to insert. None of them may be NULL.
+ * @param[in] count Number of elements in @p data. Must be greater than 0.
+ * @param[out] pushed Receives the number of inserted elements, a prefix of @p data.
+ * @return `DSA_SUCCESS` if at least one element was inserted, `DSA_INVALID_INPUT` on bad arguments,
+ *         or `DSA_FULL` if the queue is full.
+ */
+dsa_error_code_t dsa_mpmc_queue_try_push_n(mpmc_queue_t handle, void* const* data, const size_t count, size_t* pushed);
+
+/**
+ * @brief Removes the element at the front of the queue if there is one.
+ *
+ * This operation is lock-free. Ownership of the element passes to the caller,
+ * so the destroy function is not called.
+ *
+ * @param[in] handle Queue handle.
+ * @param[out] data Receives the removed element.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` on bad arguments,
+ *         or `DSA_EMPTY_LIST` if the queue is empty.
+ */
+dsa_error_code_t dsa_mpmc_queue_try_pop(mpmc_queue_t handle, void** data);
+
+/**
+ * @brief Removes the element at the front of the queue, waiting until there is one.
+ *
+ * The calling thread spins and then yields while the queue is empty.
+ *
+ * @param[in] handle Queue handle.
+ * @param[out] data Receives the removed element.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` on bad arguments.
+ */
+dsa_error_code_t dsa_mpmc_queue_pop(mpmc_queue_t handle, void** data);
+
+/**
+ * @brief Removes up to @p capacity elements from the front of the queue.
+ *
+ * Consecutive filled slots are claimed with a single compare-and-swap.
+ *
+ * @param[in] handle Queue handle.
+ * @param[out] data Array receiving the removed elements in FIFO order.
+ * @param[in] capacity Number of elements @p data can hold. Must be greater than 0.
+ * @param[out] popped Receives the number of removed elements.
+ * @return `DSA_SUCCESS` if at least one element was removed, `DSA_INVALID_INPUT` on bad arguments,
+ *         or `DSA_EMPTY_LIST` if the queue is empty.
+ */
+dsa_error_code_t dsa_mpmc_queue_try_pop_n(mpmc_queue_t handle, void** data, const size_t capacity, size_t* popped);
+
+/**
+ * @brief Destroys the queue and frees its memory.
+ *
+ * If a destroy function was provided at creation, it is called for each remaining element.
+ * No other thread may access the queue during or after this call.
+ *
+ * @param[in] handle Queue handle to destroy. Safe to call with NULL.
+ */
+void dsa_mpmc_queue_destroy(mpmc_queue_t handle);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
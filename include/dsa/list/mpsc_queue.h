@@ -0,0 +1,100 @@
+/**
+ * @file mpsc_queue.h
+ * @brief Intrusive lock-free multi-producer single-consumer FIFO queue using an opaque handle.
+ *
+ * The algorithm follows Dmitry Vyukov's intrusive MPSC queue. Producers link elements with
+ * a single atomic exchange and never wait for each other. The consumer never blocks
+ * producers. The link field (@ref mpsc_queue_link_t) is embedded in the user's own struct
+ * and the enclosing object is recovered with @ref DSA_CONTAINER_OF, so pushing and popping
+ * never allocate memory.
+ *
+ * @note Any number of threads may call `dsa_mpsc_queue_push()` concurrently, but only one
+ *       thread at a time may call `dsa_mpsc_queue_pop()`.
+ */
+
+#pragma once
+
+#include "dsa/common/atomic.h"
+#include "dsa/common/container_of.h"
+#include "dsa/common/error_codes.h"
+#include "dsa/list/slist.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Link field embedded in objects stored in an MPSC queue.
+ *
+ * The field is managed by the queue and must not be accessed by the user.
+ * A link may belong to at most one queue at a time.
+ */
+typedef struct mpsc_queue_link
+{
+    DSA_ATOMIC(struct mpsc_queue_link*) next;
+} mpsc_queue_link_t;
+
+/**
+ * @brief Opaque struct representing an MPSC queue.
+ */
+struct mpsc_queue;
+
+/**
+ * @brief Handle to an MPSC queue.
+ */
+typedef struct mpsc_queue* mpsc_queue_t;
+
+/**
+ * @brief Creates a new MPSC queue.
+ *
+ * @param[out] handle Pointer to a handle that will point to the created queue.
+ * @param[in] func Optional destructor called with the link of each element still queued when
+ *                 the queue is destroyed. Pass NULL if not needed.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if @p handle is NULL,
+ *         or `DSA_ALLOC_FAILURE` if memory allocation fails.
+ */
+dsa_error_code_t dsa_mpsc_queue_create(mpsc_queue_t* handle, slist_destroy_element_func func);
+
+/**
+ * @brief Appends an element at the back of the queue.
+ *
+ * This operation is wait-free: it performs one atomic exchange and one atomic store.
+ * It may be called from any number of threads concurrently.
+ *
+ * @param[in] handle Queue handle.
+ * @param[in] link Link of the element to append. Must not currently belong to any queue.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` on bad arguments.
+ */
+dsa_error_code_t dsa_mpsc_queue_push(mpsc_queue_t handle, mpsc_queue_link_t* link);
+
+/**
+ * @brief Removes the element at the front of the queue.
+ *
+ * This operation is lock-free and must only be called by the single consumer thread.
+ * While a producer is between its two steps of `dsa_mpsc_queue_push()`, the elements it is
+ * publishing and everything after them are not yet visible, and `DSA_EMPTY_LIST` is reported.
+ * They become visible once that push completes.
+ *
+ * @param[in] handle Queue handle.
+ * @param[out] link Receives the link of the removed element.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` on bad arguments,
+ *         or `DSA_EMPTY_LIST` if no element is available.
+ */
+dsa_error_code_t dsa_mpsc_queue_pop(mpsc_queue_t handle, mpsc_queue_link_t** link);
+
+/**
+ * @brief Destroys the queue.
+ *
+ * If a destroy function was provided at creation, it is called with the link of each
+ * remaining element. No other thread may access the queue during or after this call.
+ *
+ * @param[in] handle Queue handle to destroy. Safe to call with NULL.
+ */
+void dsa_mpsc_queue_destroy(mpsc_queue_t handle);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
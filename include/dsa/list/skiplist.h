@@ -0,0 +1,218 @@
+/**
+ * @file skiplist.h
+ * @brief Ordered set of elements backed by a skip list, using an opaque handle.
+ *
+ * Elements are kept sorted by a user-provided comparison function. Insertion, lookup and
+ * removal run in expected logarithmic time O(log n), and the elements can be traversed in
+ * order, starting from any position found with `dsa_skiplist_lower_bound()`. Element
+ * ownership follows the same rules as @ref slist_t: if a destroy callback is given, it is
+ * called for every element that is erased or still stored when the set is cleared or destroyed.
+ *
+ * @note This implementation is **not thread-safe**. It is designed for single-threaded use.
+ *       If you need to use it in a multithreaded context, external synchronization is required.
+ */
+
+#pragma once
+
+#include "dsa/common/allocator.h"
+#include "dsa/common/error_codes.h"
+#include "dsa/list/slist.h"
+#include "dsa/utility/for_each.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Opaque struct representing a skip list.
+ */
+struct skiplist;
+
+/**
+ * @brief Handle to a skip list.
+ */
+typedef struct skiplist* skiplist_t;
+
+/**
+ * @brief Iterator over the elements of a skip list, in ascending order.
+ *
+ * An iterator equal to NULL denotes the end of the list. Iterators are invalidated
+ * when the element they refer to is erased.
+ */
+typedef struct skiplist_node* skiplist_iterator_t;
+
+/**
+ * @brief Function pointer type for ordering skip list elements.
+ *
+ * @param elem Pointer to an element stored in the list.
+ * @param key Pointer to another element, or to a search key passed to the lookup functions.
+ * @return A negative value if @p elem orders before @p key, `0` if they are equivalent,
+ *         and a positive value if @p elem orders after @p key.
+ */
+typedef int (*skiplist_compare_func)(const void* elem, const void* key);
+
+/**
+ * @brief Creates a new, empty skip list.
+ *
+ * @param[out] handle Pointer to a handle that will point to the created list.
+ * @param[in] compare Function defining the order of the elements.
+ * @param[in] func Optional destructor function for elements. Pass NULL if not needed.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if @p handle or @p compare is NULL,
+ *         or `DSA_ALLOC_FAILURE` if memory allocation fails.
+ */
+dsa_error_code_t dsa_skiplist_create(skiplist_t* handle, skiplist_compare_func compare, slist_destroy_element_func func);
+
+/**
+ * @brief Creates a new, empty skip list that obtains its memory from @p allocator.
+ *
+ * The allocator is copied into the list and used for the list itself and all of its nodes.
+ *
+ * @param[out] handle Pointer to a handle that will point to the created list.
+ * @param[in] compare Function defining the order of the elements.
+ * @param[in] func Optional destructor function for elements. Pass NULL if not needed.
+ * @param[in] allocator Allocator to use, or NULL for the current default allocator.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if @p handle or @p compare is NULL or
+ *         @p allocator lacks a required callback, or `DSA_ALLOC_FAILURE` if memory allocation fails.
+ */
+dsa_error_code_t dsa_skiplist_create_with_allocator(skiplist_t* handle, skiplist_compare_func compare, slist_destroy_element_func func,
+                                                    const dsa_allocator_t* allocator);
+
+/**
+ * @brief Inserts an element, keeping the list sorted.
+ *
+ * This operation runs in expected logarithmic time O(log n). If an equivalent element is
+ * already stored, the list is left unchanged and @p data is not taken over by the list.
+ *
+ * @param[in] handle List handle.
+ * @param[in] data Pointer to the element to insert. Must not be NULL.
+ * @param[out] inserted Set to true if the element was inserted, false if an equivalent
+ *                      element was already stored. May be NULL.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` on bad arguments,
+ *         or `DSA_ALLOC_FAILURE` if memory allocation fails.
+ */
+dsa_error_code_t dsa_skiplist_insert(skiplist_t handle, void* data, bool* inserted);
+
+/**
+ * @brief Looks up the element equivalent to @p key.
+ *
+ * This operation runs in expected logarithmic time O(log n).
+ *
+ * @param[in] handle List handle.
+ * @param[in] key Search key, passed as the second argument of the comparison function.
+ * @param[out] data Pointer to the element found. Set to NULL if no element is equivalent to @p key.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if arguments are invalid.
+ */
+dsa_error_code_t dsa_skiplist_find(skiplist_t handle, const void* key, void** data);
+
+/**
+ * @brief Removes the element equivalent to @p key and calls the destroy callback on it.
+ *
+ * This operation runs in expected logarithmic time O(log n).
+ *
+ * @param[in] handle List handle.
+ * @param[in] key Search key, passed as the second argument of the comparison function.
+ * @param[out] erased Set to true if an element was removed, false otherwise. May be NULL.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if arguments are invalid.
+ */
+dsa_error_code_t dsa_skiplist_erase(skiplist_t handle, const void* key, bool* erased);
+
+/**
+ * @brief Obtains an iterator to the first element that does not order before @p key.
+ *
+ * This operation runs in expected logarithmic time O(log n). Together with
+ * `dsa_skiplist_next()` it allows scanning a range of elements in ascending order.
+ *
+ * @param[in] handle List handle.
+ * @param[in] key Search key, passed as the second argument of the comparison function.
+ * @param[out] it Receives the iterator. Set to NULL if all elements order before @p key.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if arguments are invalid.
+ */
+dsa_error_code_t dsa_skiplist_lower_bound(skiplist_t handle, const void* key, skiplist_iterator_t* it);
+
+/**
+ * @brief Obtains an iterator to the smallest element of the list.
+ *
+ * @param[in] handle List handle.
+ * @param[out] it Receives the iterator. Set to NULL if the list is empty.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if arguments are invalid.
+ */
+dsa_error_code_t dsa_skiplist_begin(skiplist_t handle, skiplist_iterator_t* it);
+
+/**
+ * @brief Advances an iterator to the next element in ascending order.
+ *
+ * This operation runs in constant time O(1). After the last element @p *it becomes NULL.
+ *
+ * @param[in,out] it Iterator to advance. Must not be at the end of the list.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if arguments are invalid.
+ */
+dsa_error_code_t dsa_skiplist_next(skiplist_iterator_t* it);
+
+/**
+ * @brief Retrieves the element an iterator refers to.
+ *
+ * @param[in] it Iterator. Must not be at the end of the list.
+ * @param[out] data Pointer to the element.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if arguments are invalid.
+ */
+dsa_error_code_t dsa_skiplist_get(skiplist_iterator_t it, void** data);
+
+/**
+ * @brief Applies @p operation to every element in the half-open range [@p first, @p last).
+ *
+ * Elements are visited in ascending order. Locating the start of the range takes expected
+ * logarithmic time O(log n); every visited element then costs O(1).
+ *
+ * @param[in] handle List handle.
+ * @param[in] first Lower bound key (inclusive), or NULL to start at the smallest element.
+ * @param[in] last Upper bound key (exclusive), or NULL to run to the largest element.
+ * @param[in] operation Function to apply to each element. It must not change the elements' order.
+ * @param[in] ctx User-provided context passed to @p operation. May be NULL.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if arguments are invalid.
+ */
+dsa_error_code_t dsa_skiplist_for_each_range(skiplist_t handle, const void* first, const void* last,
+                                             dsa_operation_with_context operation, void* ctx);
+
+/**
+ * @brief Gets the number of elements in the list.
+ *
+ * This operation runs in constant time O(1).
+ *
+ * @param[in] handle List handle.
+ * @param[out] size Pointer to the variable that will receive the list size.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` on bad arguments.
+ */
+dsa_error_code_t dsa_skiplist_get_size(skiplist_t handle, size_t* size);
+
+/**
+ * @brief Checks whether the list is empty.
+ *
+ * This operation runs in constant time O(1).
+ *
+ * @param[in] handle List handle.
+ * @param[out] is_empty Set to true if the list is empty, false otherwise.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if arguments are invalid.
+ */
+dsa_error_code_t dsa_skiplist_is_empty(skiplist_t handle, bool* is_empty);
+
+/**
+ * @brief Removes all elements from the list, calling the destroy callback on each of them.
+ *
+ * @param[in] handle List handle.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if the handle is NULL.
+ */
+dsa_error_code_t dsa_skiplist_clear(skiplist_t handle);
+
+/**
+ * @brief Destroys the list and frees all associated memory.
+ *
+ * @param[in] handle List handle.
+ */
+void dsa_skiplist_destroy(skiplist_t handle);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
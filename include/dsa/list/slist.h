@@ -11,7 +11,9 @@
 
 #pragma once
 
+#include "dsa/common/allocator.h"
 #include "dsa/common/error_codes.h"
+#include "dsa/utility/for_each.h"
 
 #include <stdbool.h>
 #include <stddef.h>
@@ -32,6 +34,23 @@ struct slist;
  */
 typedef struct slist* slist_t;
 
+/**
+ * @brief Iterator over the elements of a singly linked list.
+ *
+ * An iterator equal to NULL denotes the end of the list. Iterators are invalidated
+ * when the element they refer to is removed from the list.
+ */
+typedef struct slist_node* slist_iterator_t;
+
+/**
+ * @brief Function pointer type for selecting list elements.
+ *
+ * @param data Pointer to the element's data.
+ * @param ctx Pointer to a user-provided context object.
+ * @return true if the element matches, false otherwise.
+ */
+typedef bool (*slist_predicate_func)(const void* data, void* ctx);
+
 /**
  * @brief Function pointer type for destroying list elements.
  *
@@ -42,6 +61,36 @@ typedef struct slist* slist_t;
  */
 typedef void (*slist_destroy_element_func)(void* data);
 
+/**
+ * @brief Function pointer type for destroying list elements in batches.
+ *
+ * When set with `dsa_slist_set_destroy_batch()`, it is called instead of the per-element
+ * destroy function with up to a few dozen data pointers at a time, before the corresponding
+ * nodes are freed. This lets the user release many elements at once (e.g. return them to a
+ * pool) instead of interleaving one free per element with the list's own node frees.
+ *
+ * @param data Array of pointers to the elements' data.
+ * @param count Number of pointers in @p data. Always greater than 0.
+ */
+typedef void (*slist_destroy_batch_func)(void** data, size_t count);
+
+/**
+ * @brief Chain of nodes detached from a list by `dsa_slist_detach()`, awaiting reclamation.
+ *
+ * The chain is independent of the list it came from and may be reclaimed incrementally,
+ * or on another thread, with `dsa_slist_chain_reclaim()`. It frees its nodes through a copy
+ * of the list's allocator, so reclaiming it while the list is in use requires an allocator
+ * that is safe to call concurrently. Its fields are managed by the library and must not be
+ * modified by the user.
+ */
+typedef struct
+{
+    slist_iterator_t head;
+    size_t size;
+    slist_destroy_element_func destroy_func;
+    slist_destroy_batch_func destroy_batch_func;
+    dsa_allocator_t allocator;
+} slist_chain_t;
 /**
  * @brief Creates a new singly linked list.
  *
@@ -51,6 +100,30 @@ typedef void (*slist_destroy_element_func)(void* data);
  */
 dsa_error_code_t dsa_slist_create(slist_t* handle, slist_destroy_element_func func);
 
+/**
+ * @brief Creates a new singly linked list that obtains its memory from @p allocator.
+ *
+ * The allocator is copied into the list and used for the list itself and all of its nodes,
+ * including nodes still held by a chain detached with `dsa_slist_detach()`.
+ *
+ * @param[out] handle Pointer to a handle that will point to the created list.
+ * @param[in] func Optional destructor function for list elements. Pass NULL if not needed.
+ * @param[in] allocator Allocator to use, or NULL for the current default allocator.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if @p handle is NULL or @p allocator
+ *         lacks a required callback, or `DSA_ALLOC_FAILURE` if memory allocation fails.
+ */
+dsa_error_code_t dsa_slist_create_with_allocator(slist_t* handle, slist_destroy_element_func func, const dsa_allocator_t* allocator);
+
+/**
+ * @brief Sets a batched destroy function, used instead of the per-element one.
+ *
+ * @param[in] handle List handle.
+ * @param[in] func Batched destructor for list elements, or NULL to go back to the
+ *                 per-element destroy function passed to `dsa_slist_create()`.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if the handle is NULL.
+ */
+dsa_error_code_t dsa_slist_set_destroy_batch(slist_t handle, slist_destroy_batch_func func);
+
 /**
  * @brief Retrieves the data stored in the head node of the list.
  *
@@ -117,6 +190,108 @@ dsa_error_code_t dsa_slist_push_front(slist_t handle, void* data);
  */
 dsa_error_code_t dsa_slist_push_back(slist_t handle, void* data);
 
+/**
+ * @brief Inserts @p count elements at the back of the list, preserving their order.
+ *
+ * All nodes are allocated in a single block, so building a large list costs one
+ * allocation instead of @p count. Either every element is inserted or, on error,
+ * the list is left unchanged.
+ *
+ * This operation runs in linear time O(count).
+ *
+ * @param[in] handle List handle.
+ * @param[in] data Array of @p count pointers to insert. None of them may be NULL.
+ * @param[in] count Number of elements in @p data. Must be greater than 0.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` on bad arguments,
+ *         or `DSA_ALLOC_FAILURE` if memory allocation fails.
+ */
+dsa_error_code_t dsa_slist_push_back_n(slist_t handle, void* const* data, const size_t count);
+
+/**
+ * @brief Moves all elements of @p other to the back of the list.
+ *
+ * No nodes are allocated or copied: the node chain of @p other is linked after the tail
+ * of @p handle. After this call @p other is empty but still valid, and the moved elements
+ * are owned by @p handle.
+ *
+ * This operation runs in constant time O(1).
+ *
+ * @param[in] handle Destination list handle.
+ * @param[in] other Source list handle. Must be distinct from @p handle and use
+ *                  the same destroy functions and an equal allocator.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` on bad arguments.
+ */
+dsa_error_code_t dsa_slist_splice(slist_t handle, slist_t other);
+
+/**
+ * @brief Copies the data pointers of all elements into @p array, from head to tail.
+ *
+ * This operation runs in linear time O(n) and does not modify the list.
+ *
+ * @param[in] handle List handle.
+ * @param[out] array Destination array.
+ * @param[in] capacity Number of elements @p array can hold. Must be at least the list size.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` on bad arguments
+ *         or when @p capacity is smaller than the list size.
+ */
+dsa_error_code_t dsa_slist_to_array(slist_t handle, void** array, const size_t capacity);
+
+/**
+ * @brief Obtains an iterator to the first element of the list.
+ *
+ * @param[in] handle List handle.
+ * @param[out] it Receives the iterator. Set to NULL if the list is empty.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if arguments are invalid.
+ */
+dsa_error_code_t dsa_slist_begin(slist_t handle, slist_iterator_t* it);
+
+/**
+ * @brief Advances an iterator to the next element.
+ *
+ * This operation runs in constant time O(1). After the last element @p *it becomes NULL.
+ *
+ * @param[in,out] it Iterator to advance. Must not be at the end of the list.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if arguments are invalid.
+ */
+dsa_error_code_t dsa_slist_next(slist_iterator_t* it);
+
+/**
+ * @brief Retrieves the data of the element an iterator refers to.
+ *
+ * @param[in] it Iterator. Must not be at the end of the list.
+ * @param[out] data Pointer to the element's data.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if arguments are invalid.
+ */
+dsa_error_code_t dsa_slist_get(slist_iterator_t it, void** data);
+
+/**
+ * @brief Applies a user-provided operation to the data of each element, from head to tail.
+ *
+ * This operation runs in linear time O(n) and performs no allocations.
+ * The operation must not add or remove list elements.
+ *
+ * @param[in] handle List handle.
+ * @param[in] operation Function called with each element's data and @p ctx.
+ * @param[in] ctx Pointer to user-defined context data (can be NULL).
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if arguments are invalid.
+ */
+dsa_error_code_t dsa_slist_for_each(slist_t handle, dsa_operation_with_context operation, void* ctx);
+
+/**
+ * @brief Removes all elements for which @p predicate returns true.
+ *
+ * The list is traversed once and matching nodes are unlinked in place, so this
+ * operation runs in linear time O(n). If a destroy function was provided at list
+ * creation, it is called on each removed element's data.
+ *
+ * @param[in] handle List handle.
+ * @param[in] predicate Function selecting the elements to remove.
+ * @param[in] ctx Pointer to user-defined context data passed to @p predicate (can be NULL).
+ * @param[out] removed Receives the number of removed elements. May be NULL.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if arguments are invalid.
+ */
+dsa_error_code_t dsa_slist_remove_if(slist_t handle, slist_predicate_func predicate, void* ctx, size_t* removed);
+
 /**
  * @brief Removes the element at the front of the list.
  *
@@ -152,6 +327,36 @@ dsa_error_code_t dsa_slist_pop_back(slist_t handle);
  */
 dsa_error_code_t dsa_slist_clear(slist_t handle);
 
+/**
+ * @brief Moves all nodes of the list into @p chain, leaving the list empty.
+ *
+ * This operation runs in constant time O(1) and neither allocates nor calls any destroy
+ * function, which makes it a cheap replacement for `dsa_slist_clear()` on latency-sensitive
+ * paths. The elements are destroyed later by `dsa_slist_chain_reclaim()`.
+ *
+ * @param[in] handle List handle.
+ * @param[out] chain Receives the detached nodes. Any chain previously stored there must
+ *                   already be fully reclaimed.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if arguments are invalid.
+ */
+dsa_error_code_t dsa_slist_detach(slist_t handle, slist_chain_t* chain);
+
+/**
+ * @brief Destroys up to @p max_count elements of a detached chain and frees their nodes.
+ *
+ * The destroy functions of the originating list are used. Reclaiming in small steps bounds
+ * the time spent per call; a chain may also be handed to a background thread as a whole.
+ * The nodes are freed through the allocator of the originating list. The list may be used
+ * or destroyed concurrently only if that allocator is thread-safe, as `dsa_allocator_system()` is;
+ * otherwise, e.g. with an arena allocator, the caller must serialize the two.
+ *
+ * @param[in,out] chain Chain produced by `dsa_slist_detach()`.
+ * @param[in] max_count Maximum number of elements to reclaim, or 0 to reclaim all of them.
+ * @param[out] remaining Receives the number of elements still in the chain. May be NULL.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if @p chain is NULL.
+ */
+dsa_error_code_t dsa_slist_chain_reclaim(slist_chain_t* chain, const size_t max_count, size_t* remaining);
+
 /**
  * @brief Reverses the order of elements in the singly linked list.
  *
@@ -5,6 +5,7 @@ extern "C"
 {
 #endif
 
+#include "dsa/common/allocator.h"
 #include "dsa/common/error_codes.h"
 
 #include <stdbool.h>
@@ -40,7 +41,8 @@ extern "C"
  *
  * @return @ref DSA_SUCCESS on success,
  *         @ref DSA_INVALID_INPUT if the input is invalid (e.g., null pointer or zero count),
- *         @ref DSA_ALLOC_FAILURE if temporary memory allocation fails.
+ *         @ref DSA_ALLOC_FAILURE if temporary memory allocation fails. Elements of up to
+ *         64 bytes are sorted without allocating.
  *
  * When the function returns, @p data contains the sorted elements.
  *
@@ -58,6 +60,29 @@ dsa_error_code_t dsa_insertion_sort(
     const size_t elem_size,
     int (*compare)(const void *key1, const void *key2));
 
+/**
+ * @brief Sorts an array of elements using insertion sort, taking scratch memory from @p allocator.
+ *
+ * Behaves exactly like @ref dsa_insertion_sort. The only scratch memory is one element,
+ * which is taken from @p allocator when it does not fit the internal stack buffer.
+ *
+ * @param[in,out] data Array of elements to sort.
+ * @param[in] size Number of elements in @p data.
+ * @param[in] elem_size Size of a single element, in bytes.
+ * @param[in] compare Comparison function used to determine order.
+ * @param[in] allocator Allocator for the scratch element, or NULL for the default allocator.
+ *
+ * @return @ref DSA_SUCCESS on success,
+ *         @ref DSA_INVALID_INPUT if the input is invalid,
+ *         @ref DSA_ALLOC_FAILURE if temporary memory allocation fails.
+ */
+dsa_error_code_t dsa_insertion_sort_with_allocator(
+    void *data,
+    const size_t size,
+    const size_t elem_size,
+    int (*compare)(const void *key1, const void *key2),
+    const dsa_allocator_t *allocator);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
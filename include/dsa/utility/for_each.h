@@ -1,7 +1,10 @@
 #pragma once
 
+#include "dsa/common/allocator.h"
 #include "dsa/common/error_codes.h"
+#include "dsa/common/executor.h"
 
+#include <stdbool.h>
 #include <stddef.h>
 
 #ifdef __cplusplus
@@ -24,6 +27,24 @@ typedef void (*dsa_operation_no_context)(void* elem);
  */
 typedef void (*dsa_operation_with_context)(void* elem, void* ctx);
 
+/**
+ * @brief Function type for operations on a contiguous block of elements.
+ *
+ * @param first Pointer to the first element of the block.
+ * @param count Number of elements in the block. Always greater than 0.
+ * @param ctx Pointer to a user-provided context object.
+ */
+typedef void (*dsa_span_operation)(void* first, size_t count, void* ctx);
+
+/**
+ * @brief Function type for selecting elements.
+ *
+ * @param elem Pointer to the element to test.
+ * @param ctx Pointer to a user-provided context object.
+ * @return true if the element matches, false otherwise.
+ */
+typedef bool (*dsa_predicate_func)(const void* elem, void* ctx);
+
 /**
  * @brief Applies a user-provided operation to each element of an array.
  *
@@ -67,6 +88,100 @@ dsa_error_code_t dsa_for_each(void* arr, const size_t count, const size_t elem_s
  */
 dsa_error_code_t dsa_for_each_ctx(void* arr, const size_t count, const size_t elem_size, dsa_operation_with_context operation, void* ctx);
 
+/**
+ * @brief Applies a user-provided operation to consecutive blocks of an array.
+ *
+ * Instead of one call per element, @p operation receives a pointer and an element count,
+ * so the per-call overhead is paid once per block and the callback can run its own tight,
+ * vectorizable loop over the block.
+ *
+ * @param arr Pointer to the first element of the array.
+ * @param count Number of elements in the array.
+ * @param elem_size Size (in bytes) of each element.
+ * @param span_size Maximum number of elements per block. 0 selects blocks of about 16 KiB.
+ *                  Every block except possibly the last one has exactly this many elements.
+ * @param operation A function that operates on a block of elements.
+ * @param ctx Pointer to user-defined context data passed to every call (can be NULL).
+ *
+ * @return @ref DSA_SUCCESS on success,
+ *         @ref DSA_INVALID_INPUT if @p arr or @p operation is NULL, or @p count or @p elem_size is zero.
+ *
+ * @note The blocks are passed in order, from the start of the array to its end.
+ *
+ * @complexity O(n), where n is the number of elements, with O(n / span_size) calls.
+ */
+dsa_error_code_t dsa_for_each_span(void* arr, const size_t count, const size_t elem_size, const size_t span_size,
+                                   dsa_span_operation operation, void* ctx);
+
+/**
+ * @brief Options controlling @ref dsa_for_each_parallel.
+ *
+ * A zero-initialized struct selects the defaults.
+ */
+typedef struct
+{
+    /**
+     * @brief Number of workers, including the calling thread. 0 selects the number of
+     *        threads of the executor.
+     */
+    size_t num_threads;
+
+    /**
+     * @brief Number of consecutive elements a worker claims at a time. 0 selects a size
+     *        giving every worker several chunks, so that faster workers take over the rest.
+     */
+    size_t chunk_size;
+
+    /**
+     * @brief Optional array of @ref num_threads contexts. Worker `i` passes `thread_ctx[i]`
+     *        to the operation instead of the shared context, which lets every worker
+     *        accumulate results without synchronization. Requires a non-zero @ref num_threads.
+     */
+    void* const* thread_ctx;
+
+    /**
+     * @brief Executor running the workers, or NULL to use the process-wide default executor.
+     */
+    dsa_executor_t executor;
+
+    /**
+     * @brief Allocator for the scratch memory of the call, such as the worker bookkeeping,
+     *        or NULL to use the process default allocator.
+     */
+    const dsa_allocator_t* allocator;
+} dsa_parallel_options_t;
+
+/**
+ * @brief Applies a user-provided operation with context to each element of an array, in parallel.
+ *
+ * The range [0, count) is split into chunks that the workers claim dynamically from a shared
+ * counter until none are left, so uneven per-element costs are balanced automatically. The
+ * workers run as tasks on an executor (see executor.h) instead of threads of their own; the
+ * calling thread works as one of them, and the function returns once every element has
+ * been visited.
+ *
+ * @param arr Pointer to the first element of the array.
+ * @param count Number of elements in the array.
+ * @param elem_size Size (in bytes) of each element.
+ * @param operation A function that operates on a single element with context. It is called
+ *                  concurrently and must be safe to run on different elements at the same time.
+ * @param ctx Pointer to user-defined context data shared by all workers. As with
+ *            @ref dsa_for_each_ctx it must not be NULL, unless per-thread contexts are given.
+ * @param options Parallelism options, or NULL to use the defaults.
+ *
+ * @return @ref DSA_SUCCESS on success,
+ *         @ref DSA_INVALID_INPUT if arguments are invalid, as for @ref dsa_for_each_ctx,
+ *         or @ref DSA_ALLOC_FAILURE if the worker bookkeeping or the default executor
+ *         could not be allocated. The bookkeeping comes from `options->allocator`.
+ *
+ * @note Elements are visited in no particular order. A worker that only starts once all
+ *       chunks have been claimed returns without calling the operation.
+ *
+ * @complexity O(n / p), where n is the number of elements and p the number of workers.
+ */
+dsa_error_code_t dsa_for_each_parallel(void* arr, const size_t count, const size_t elem_size, dsa_operation_with_context operation,
+                                       void* ctx, const dsa_parallel_options_t* options);
+
 #ifdef __cplusplus
 }
 #endif
@@ -3,6 +3,7 @@
 #include "dsa/common/error_codes.h"
 
 #include <stddef.h>
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C"
@@ -42,6 +43,44 @@ dsa_error_code_t dsa_min_element_index(
     int (*compare)(const void* a, const void* b),
     size_t* min_element_index);
 
+/**
+ * @brief Finds the index of the minimum element of a `double` array.
+ *
+ * Equivalent to @ref dsa_min_element_index with a `<`/`>` based comparator, but without
+ * a function call per element: on x86 CPUs supporting AVX2 (detected at run time) the
+ * array is scanned with packed instructions, elsewhere a plain scalar loop is used.
+ *
+ * @param arr Pointer to the first element of the array. Must not be NULL.
+ * @param size Number of elements in the array. Must be greater than 0.
+ * @param[out] min_element_index Pointer to store the index of the minimum element.
+ *
+ * @retval DSA_SUCCESS If the operation completed successfully.
+ * @retval DSA_INVALID_INPUT If any of the input parameters are invalid.
+ *
+ * @note If multiple elements are equal to the minimum, the first (lowest index) is returned.
+ *       `-0.0` and `+0.0` are considered equal.
+ *
+ * @note NaN elements are ignored. If every element is NaN, 0 is returned.
+ *
+ * @complexity O(n), where n is the number of elements in the array.
+ */
+dsa_error_code_t dsa_min_element_index_f64(const double* arr, const size_t size, size_t* min_element_index);
+
+/**
+ * @brief Finds the index of the minimum element of a `float` array.
+ *
+ * See @ref dsa_min_element_index_f64, including the treatment of ties and NaNs.
+ */
+dsa_error_code_t dsa_min_element_index_f32(const float* arr, const size_t size, size_t* min_element_index);
+
+/**
+ * @brief Finds the index of the minimum element of an `int32_t` array.
+ *
+ * See @ref dsa_min_element_index_f64. If multiple elements are equal to the minimum,
+ * the first (lowest index) is returned.
+ */
+dsa_error_code_t dsa_min_element_index_i32(const int32_t* arr, const size_t size, size_t* min_element_index);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "dsa/common/error_codes.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Finds the indices of both the minimum and the maximum element in a single pass.
+ *
+ * Elements are processed in pairs: the two elements of a pair are compared with each other
+ * first, and then only the smaller one is compared with the current minimum and only the
+ * larger one with the current maximum. This takes about 3n/2 comparator calls instead of
+ * the 2n needed by calling @ref dsa_min_element_index and @ref dsa_max_element_index.
+ *
+ * @param arr Pointer to the first element of the array. Must not be NULL.
+ * @param size Number of elements in the array. Must be greater than 0.
+ * @param elem_size Size in bytes of a single element. Must be greater than 0.
+ * @param compare Pointer to a comparison function. The function must return:
+ *        - A negative value if (a < b),
+ *        - Zero if (a == b),
+ *        - A positive value if (a > b).
+ * @param[out] min_element_index Pointer to store the index of the minimum element. Must not be NULL.
+ * @param[out] max_element_index Pointer to store the index of the maximum element. Must not be NULL.
+ *
+ * @retval DSA_SUCCESS If the operation completed successfully.
+ * @retval DSA_INVALID_INPUT If any of the input parameters are invalid.
+ *
+ * @note If several elements are equal to the minimum or to the maximum, the first
+ *       (lowest index) one is reported, exactly as by @ref dsa_min_element_index
+ *       and @ref dsa_max_element_index.
+ *
+ * @complexity O(n), where n is the number of elements in the array.
+ */
+dsa_error_code_t dsa_minmax_element_index(
+    const void* arr,
+    const size_t size,
+    const size_t elem_size,
+    int (*compare)(const void* a, const void* b),
+    size_t* min_element_index,
+    size_t* max_element_index);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "dsa/common/error_codes.h"
+#include "dsa/utility/for_each.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Reorders an array so that all elements satisfying @p predicate precede all others.
+ *
+ * Uses Hoare-style partitioning from both ends. The predicate is first evaluated for
+ * whole blocks of elements, recording the positions of misplaced ones without branching
+ * on the result, and the misplaced elements are then swapped in pairs. This keeps the
+ * loop free of hard-to-predict branches when the outcome is random.
+ *
+ * @param arr Pointer to the first element of the array.
+ * @param count Number of elements in the array.
+ * @param elem_size Size (in bytes) of each element.
+ * @param predicate Function selecting the elements to move to the front. It may be called
+ *                  more than once for the same element, so it must not have side effects.
+ * @param ctx Pointer to user-defined context data passed to @p predicate (can be NULL).
+ * @param[out] partition_point Receives the number of elements satisfying @p predicate,
+ *                             i.e. the index of the first element of the second group.
+ *
+ * @return @ref DSA_SUCCESS on success,
+ *         @ref DSA_INVALID_INPUT if any pointer other than @p ctx is NULL, or @p count or @p elem_size is zero.
+ *
+ * @note The relative order of elements within each group is not preserved.
+ *
+ * @complexity O(n) predicate calls and at most n / 2 swaps, where n is the number of elements.
+ */
+dsa_error_code_t dsa_partition(void* arr, const size_t count, const size_t elem_size,
+                               dsa_predicate_func predicate, void* ctx, size_t* partition_point);
+
+/**
+ * @brief Reorders an array like @ref dsa_partition, preserving the relative order within both groups.
+ *
+ * With a scratch buffer large enough for the whole array the elements are moved in a single
+ * O(n) pass. Otherwise the array is split recursively into parts that fit into the buffer
+ * (or into single elements without one), and the partitioned parts are merged by rotation,
+ * which takes O(n log n) element moves. No memory is allocated in either case.
+ *
+ * @param arr Pointer to the first element of the array.
+ * @param count Number of elements in the array.
+ * @param elem_size Size (in bytes) of each element.
+ * @param predicate Function selecting the elements to move to the front. Called exactly once per element.
+ * @param ctx Pointer to user-defined context data passed to @p predicate (can be NULL).
+ * @param scratch Optional buffer of @p scratch_count elements of @p elem_size bytes. May be NULL.
+ * @param scratch_count Number of elements @p scratch can hold. Ignored if @p scratch is NULL.
+ * @param[out] partition_point Receives the number of elements satisfying @p predicate.
+ *
+ * @return @ref DSA_SUCCESS on success,
+ *         @ref DSA_INVALID_INPUT if @p arr, @p predicate or @p partition_point is NULL,
+ *         or @p count or @p elem_size is zero.
+ *
+ * @complexity O(n) with a scratch buffer of at least n elements, O(n log n) otherwise.
+ */
+dsa_error_code_t dsa_stable_partition(void* arr, const size_t count, const size_t elem_size,
+                                      dsa_predicate_func predicate, void* ctx,
+                                      void* scratch, const size_t scratch_count, size_t* partition_point);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "dsa/common/error_codes.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Function type folding one element into an accumulator.
+ *
+ * Used by @ref dsa_reduce and the generic scans.
+ *
+ * @param acc Pointer to the accumulator, updated in place.
+ * @param elem Pointer to the element to fold into the accumulator.
+ * @param ctx Pointer to a user-provided context object.
+ */
+typedef void (*dsa_combine_func)(void* acc, const void* elem, void* ctx);
+
+/**
+ * @brief Folds all elements of an array into an accumulator, from the first to the last.
+ *
+ * @param arr Pointer to the first element of the array.
+ * @param count Number of elements in the array.
+ * @param elem_size Size (in bytes) of each element.
+ * @param[in,out] result Accumulator. Holds the initial value on entry and the result on return.
+ * @param combine Function folding one element into the accumulator.
+ * @param ctx Pointer to user-defined context data passed to @p combine (can be NULL).
+ *
+ * @return @ref DSA_SUCCESS on success,
+ *         @ref DSA_INVALID_INPUT if any pointer other than @p ctx is NULL, or @p count or @p elem_size is zero.
+ *
+ * @complexity O(n), where n is the number of elements.
+ */
+dsa_error_code_t dsa_reduce(const void* arr, const size_t count, const size_t elem_size, void* result, dsa_combine_func combine, void* ctx);
+
+/**
+ * @brief Sums an `int32_t` array into a 64-bit result, which cannot overflow for any array that fits in memory.
+ *
+ * @param arr Pointer to the first element of the array.
+ * @param count Number of elements in the array.
+ * @param[out] result Receives the sum.
+ *
+ * @return @ref DSA_SUCCESS on success,
+ *         @ref DSA_INVALID_INPUT if a pointer is NULL or @p count is zero.
+ */
+dsa_error_code_t dsa_reduce_sum_i32(const int32_t* arr, const size_t count, int64_t* result);
+
+/**
+ * @brief Sums a `double` array.
+ *
+ * The elements are accumulated in several independent lanes that are added together at
+ * the end, which lets the loop use SIMD instructions. The result may therefore differ in
+ * the last bits from a strictly sequential sum.
+ *
+ * @param arr Pointer to the first element of the array.
+ * @param count Number of elements in the array.
+ * @param[out] result Receives the sum.
+ *
+ * @return @ref DSA_SUCCESS on success,
+ *         @ref DSA_INVALID_INPUT if a pointer is NULL or @p count is zero.
+ */
+dsa_error_code_t dsa_reduce_sum_f64(const double* arr, const size_t count, double* result);
+
+/**
+ * @brief Computes the smallest value of an `int32_t` array.
+ *
+ * Uses the same kernels as @ref dsa_min_element_index_i32.
+ *
+ * @return @ref DSA_SUCCESS on success,
+ *         @ref DSA_INVALID_INPUT if a pointer is NULL or @p count is zero.
+ */
+dsa_error_code_t dsa_reduce_min_i32(const int32_t* arr, const size_t count, int32_t* result);
+
+/**
+ * @brief Computes the largest value of an `int32_t` array.
+ *
+ * Uses the same kernels as @ref dsa_max_element_index_i32.
+ *
+ * @return @ref DSA_SUCCESS on success,
+ *         @ref DSA_INVALID_INPUT if a pointer is NULL or @p count is zero.
+ */
+dsa_error_code_t dsa_reduce_max_i32(const int32_t* arr, const size_t count, int32_t* result);
+
+/**
+ * @brief Computes the smallest value of a `double` array.
+ *
+ * Uses the same kernels as @ref dsa_min_element_index_f64: NaN elements are ignored,
+ * and the result is NaN only if every element is NaN.
+ *
+ * @return @ref DSA_SUCCESS on success,
+ *         @ref DSA_INVALID_INPUT if a pointer is NULL or @p count is zero.
+ */
+dsa_error_code_t dsa_reduce_min_f64(const double* arr, const size_t count, double* result);
+
+/**
+ * @brief Computes the largest value of a `double` array.
+ *
+ * Uses the same kernels as @ref dsa_max_element_index_f64: NaN elements are ignored,
+ * and the result is NaN only if every element is NaN.
+ *
+ * @return @ref DSA_SUCCESS on success,
+ *         @ref DSA_INVALID_INPUT if a pointer is NULL or @p count is zero.
+ */
+dsa_error_code_t dsa_reduce_max_f64(const double* arr, const size_t count, double* result);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "dsa/common/error_codes.h"
+#include "dsa/utility/for_each.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Removes all elements satisfying @p predicate from an array in place.
+ *
+ * The remaining elements are moved to the front of the array in their original order;
+ * the contents of the array past the new size are unspecified. Elements are only copied
+ * once the first removed element has been found, so filtering an array that keeps most
+ * of its elements writes little memory.
+ *
+ * @param arr Pointer to the first element of the array.
+ * @param count Number of elements in the array.
+ * @param elem_size Size (in bytes) of each element.
+ * @param predicate Function selecting the elements to remove. Called exactly once per element, in order.
+ * @param ctx Pointer to user-defined context data passed to @p predicate (can be NULL).
+ * @param[out] new_count Receives the number of elements kept.
+ *
+ * @return @ref DSA_SUCCESS on success,
+ *         @ref DSA_INVALID_INPUT if any pointer other than @p ctx is NULL, or @p count or @p elem_size is zero.
+ *
+ * @complexity O(n), where n is the number of elements.
+ */
+dsa_error_code_t dsa_remove_if(void* arr, const size_t count, const size_t elem_size,
+                               dsa_predicate_func predicate, void* ctx, size_t* new_count);
+
+#ifdef __cplusplus
+}
+#endif
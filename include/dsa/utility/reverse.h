@@ -20,14 +20,14 @@ extern "C"
  * @param count Number of elements in the array.
  * @param elem_size Size of each element in bytes.
  * @return @ref DSA_SUCCESS on success,
- *         @ref DSA_INVALID_INPUT if the input is invalid (e.g., null pointer or zero count),
- *         @ref DSA_ALLOC_FAILURE if temporary memory allocation fails.
+ *         @ref DSA_INVALID_INPUT if the input is invalid (e.g., null pointer or zero count).
  *
  * @note The memory pointed to by @p arr must be writable and large enough
  *       to hold @p count elements of size @p elem_size.
  *
- * @note The operation is performed in place, using temporary memory only
- *       for swapping a single element.
+ * @note The operation is performed in place and never allocates memory. Arrays of
+ *       1, 2, 4, 8 or 16 byte elements are processed in 16-byte blocks; larger
+ *       elements are swapped piecewise through a small stack buffer.
  *
  * @complexity O(n), where n is the number of elements in the array.
  *
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "dsa/common/error_codes.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Rotates an array in place so that the element at index @p middle becomes the first one.
+ *
+ * Elements `[middle, count)` are moved to the front and elements `[0, middle)` after them,
+ * both keeping their order. The algorithm depends on the sizes involved:
+ * - if the shorter part fits in a small stack buffer, it is set aside while the longer
+ *   part is shifted with one `memmove`;
+ * - arrays that fit in the L1 cache are rotated along GCD cycles ("juggling"),
+ *   which moves every element exactly once;
+ * - larger arrays use block swaps (Gries-Mills), which only touch memory sequentially.
+ *
+ * No heap memory is allocated, whatever the element size.
+ *
+ * @param arr Pointer to the first element of the array.
+ * @param count Number of elements in the array.
+ * @param elem_size Size (in bytes) of each element.
+ * @param middle Index of the element that becomes the first one. Must not exceed @p count;
+ *               0 and @p count leave the array unchanged.
+ *
+ * @return @ref DSA_SUCCESS on success,
+ *         @ref DSA_INVALID_INPUT if @p arr is NULL, @p count or @p elem_size is zero,
+ *         or @p middle is greater than @p count.
+ *
+ * @complexity O(n), where n is the number of elements.
+ */
+dsa_error_code_t dsa_rotate(void* arr, const size_t count, const size_t elem_size, const size_t middle);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "dsa/common/allocator.h"
+#include "dsa/common/error_codes.h"
+#include "dsa/utility/for_each.h"
+#include "dsa/utility/reduce.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Computes the inclusive prefix scan of an array: `out[i] = in[0] ⊕ ... ⊕ in[i]`.
+ *
+ * `out[0]` is a copy of `in[0]`; every following output is a copy of the previous one
+ * with the next input element folded in by @p combine.
+ *
+ * @param in Pointer to the first input element.
+ * @param out Pointer to the first output element. May be equal to @p in; the arrays must
+ *            not overlap otherwise.
+ * @param count Number of elements.
+ * @param elem_size Size (in bytes) of each element.
+ * @param combine Function folding an element into an accumulator.
+ * @param ctx Pointer to user-defined context data passed to @p combine (can be NULL).
+ *
+ * @return @ref DSA_SUCCESS on success,
+ *         @ref DSA_INVALID_INPUT if any pointer other than @p ctx is NULL, or @p count or @p elem_size is zero,
+ *         @ref DSA_ALLOC_FAILURE if the accumulator for elements larger than 128 bytes cannot be allocated.
+ *
+ * @complexity O(n), where n is the number of elements.
+ */
+dsa_error_code_t dsa_inclusive_scan(const void* in, void* out, const size_t count, const size_t elem_size,
+                                    dsa_combine_func combine, void* ctx);
+
+/**
+ * @brief Computes the inclusive prefix scan of an array, taking scratch memory from @p allocator.
+ *
+ * Behaves exactly like @ref dsa_inclusive_scan. The only scratch memory is the accumulator
+ * for elements larger than 128 bytes.
+ *
+ * @param allocator Allocator for the accumulator, or NULL for the default allocator.
+ */
+dsa_error_code_t dsa_inclusive_scan_with_allocator(const void* in, void* out, const size_t count, const size_t elem_size,
+                                                   dsa_combine_func combine, void* ctx, const dsa_allocator_t* allocator);
+
+/**
+ * @brief Computes the exclusive prefix scan of an array: `out[i] = init ⊕ in[0] ⊕ ... ⊕ in[i - 1]`.
+ *
+ * @param in Pointer to the first input element.
+ * @param out Pointer to the first output element. May be equal to @p in; the arrays must
+ *            not overlap otherwise.
+ * @param count Number of elements.
+ * @param elem_size Size (in bytes) of each element.
+ * @param init Pointer to the initial value, written to `out[0]`.
+ * @param combine Function folding an element into an accumulator.
+ * @param ctx Pointer to user-defined context data passed to @p combine (can be NULL).
+ *
+ * @return @ref DSA_SUCCESS on success,
+ *         @ref DSA_INVALID_INPUT if any pointer other than @p ctx is NULL, or @p count or @p elem_size is zero,
+ *         @ref DSA_ALLOC_FAILURE if the accumulator for elements larger than 64 bytes cannot be allocated.
+ *
+ * @complexity O(n), where n is the number of elements.
+ */
+dsa_error_code_t dsa_exclusive_scan(const void* in, void* out, const size_t count, const size_t elem_size,
+                                    const void* init, dsa_combine_func combine, void* ctx);
+
+/**
+ * @brief Computes the exclusive prefix scan of an array, taking scratch memory from @p allocator.
+ *
+ * Behaves exactly like @ref dsa_exclusive_scan. The only scratch memory is the accumulator
+ * for elements larger than 64 bytes.
+ *
+ * @param allocator Allocator for the accumulator, or NULL for the default allocator.
+ */
+dsa_error_code_t dsa_exclusive_scan_with_allocator(const void* in, void* out, const size_t count, const size_t elem_size,
+                                                   const void* init, dsa_combine_func combine, void* ctx,
+                                                   const dsa_allocator_t* allocator);
+
+/**
+ * @brief Computes running sums of a `double` array: `out[i] = in[0] + ... + in[i]`.
+ *
+ * Large inputs are scanned in parallel in two passes: the workers first sum their own
+ * blocks, and after the block offsets are known, scan their blocks again with the offset
+ * added. Floating-point results may then differ in the last bits from a sequential scan.
+ *
+ * @param in Pointer to the first input element.
+ * @param out Pointer to the first output element. May be equal to @p in; the arrays must
+ *            not overlap otherwise.
+ * @param count Number of elements.
+ * @param options Parallelism options, or NULL for the defaults. `num_threads`, `executor` and
+ *                `allocator` are used; a `num_threads` of 1 forces a sequential scan.
+ *
+ * @return @ref DSA_SUCCESS on success,
+ *         @ref DSA_INVALID_INPUT if a pointer is NULL or @p count is zero.
+ *
+ * @complexity O(n), where n is the number of elements.
+ */
+dsa_error_code_t dsa_inclusive_scan_sum_f64(const double* in, double* out, const size_t count, const dsa_parallel_options_t* options);
+
+/**
+ * @brief Computes running sums of an `int64_t` array: `out[i] = in[0] + ... + in[i]`.
+ *
+ * See @ref dsa_inclusive_scan_sum_f64. Integer results do not depend on the number of workers.
+ */
+dsa_error_code_t dsa_inclusive_scan_sum_i64(const int64_t* in, int64_t* out, const size_t count, const dsa_parallel_options_t* options);
+
+/**
+ * @brief Computes exclusive running sums of a `double` array: `out[i] = init + in[0] + ... + in[i - 1]`.
+ *
+ * See @ref dsa_inclusive_scan_sum_f64.
+ */
+dsa_error_code_t dsa_exclusive_scan_sum_f64(const double* in, double* out, const size_t count, const double init,
+                                            const dsa_parallel_options_t* options);
+
+/**
+ * @brief Computes exclusive running sums of an `int64_t` array: `out[i] = init + in[0] + ... + in[i - 1]`.
+ *
+ * See @ref dsa_inclusive_scan_sum_f64. Integer results do not depend on the number of workers.
+ */
+dsa_error_code_t dsa_exclusive_scan_sum_i64(const int64_t* in, int64_t* out, const size_t count, const int64_t init,
+                                            const dsa_parallel_options_t* options);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "dsa/common/error_codes.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Function type computing one output element from one input element.
+ *
+ * @param out Pointer to the output element to write.
+ * @param in Pointer to the input element.
+ * @param ctx Pointer to a user-provided context object.
+ */
+typedef void (*dsa_transform_func)(void* out, const void* in, void* ctx);
+
+/**
+ * @brief Writes `func(in[i])` to `out[i]` for every element of an array.
+ *
+ * Input and output element types may differ, e.g. to parse or convert values.
+ *
+ * @param in Pointer to the first input element.
+ * @param count Number of elements to transform.
+ * @param in_elem_size Size (in bytes) of each input element.
+ * @param out Pointer to the first output element. May be equal to @p in if both element
+ *            sizes are equal; the arrays must not overlap otherwise.
+ * @param out_elem_size Size (in bytes) of each output element.
+ * @param func Function computing an output element.
+ * @param ctx Pointer to user-defined context data passed to @p func (can be NULL).
+ *
+ * @return @ref DSA_SUCCESS on success,
+ *         @ref DSA_INVALID_INPUT if any pointer other than @p ctx is NULL, or a count or size is zero.
+ *
+ * @note Elements are processed in order from index 0 to count - 1.
+ *
+ * @complexity O(n), where n is the number of elements.
+ */
+dsa_error_code_t dsa_transform(const void* in, const size_t count, const size_t in_elem_size,
+                               void* out, const size_t out_elem_size, dsa_transform_func func, void* ctx);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "dsa/common/error_codes.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Removes consecutive duplicate elements from an array in place.
+ *
+ * Of every run of consecutive elements comparing equal, only the first one is kept. The
+ * kept elements are moved to the front of the array in their original order; the contents
+ * of the array past the new size are unspecified. To remove all duplicates, sort the
+ * array first.
+ *
+ * @param arr Pointer to the first element of the array.
+ * @param count Number of elements in the array.
+ * @param elem_size Size (in bytes) of each element.
+ * @param compare Comparison function. Two elements are duplicates if it returns 0.
+ * @param[out] new_count Receives the number of elements kept.
+ *
+ * @return @ref DSA_SUCCESS on success,
+ *         @ref DSA_INVALID_INPUT if any pointer is NULL, or @p count or @p elem_size is zero.
+ *
+ * @complexity O(n), where n is the number of elements, with n - 1 comparisons.
+ */
+dsa_error_code_t dsa_unique(void* arr, const size_t count, const size_t elem_size,
+                            int (*compare)(const void* a, const void* b), size_t* new_count);
+
+#ifdef __cplusplus
+}
+#endif
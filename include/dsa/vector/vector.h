@@ -0,0 +1,220 @@
+/**
+ * @file vector.h
+ * @brief Growable contiguous array of fixed-size elements using an opaque handle.
+ *
+ * The vector owns a single buffer of `size * elem_size` bytes, which can be passed
+ * directly to the generic algorithms of this library (`dsa_insertion_sort()`,
+ * `dsa_for_each()`, `dsa_binary_search_index()`, ...) through `dsa_vector_data()`.
+ * The buffer grows geometrically by a factor of 1.5, so appending n elements one at a
+ * time copies O(n) bytes in total. An optional alignment lets SIMD kernels use aligned
+ * loads on the buffer.
+ *
+ * @note Pointers into the buffer are invalidated by any operation that may reallocate it
+ *       (insertion, `dsa_vector_reserve()`, `dsa_vector_shrink_to_fit()`).
+ *
+ * @note This implementation is **not thread-safe**. It is designed for single-threaded use.
+ *       If you need to use it in a multithreaded context, external synchronization is required.
+ */
+
+#pragma once
+
+#include "dsa/common/allocator.h"
+#include "dsa/common/error_codes.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Opaque struct representing a vector.
+ */
+struct vector;
+
+/**
+ * @brief Handle to a vector.
+ */
+typedef struct vector* vector_t;
+
+/**
+ * @brief Function pointer type for releasing resources owned by a vector element.
+ *
+ * Called when an element is removed or the vector is cleared or destroyed.
+ * The element's storage itself belongs to the vector and must not be freed.
+ *
+ * @param elem Pointer to the element inside the vector's buffer.
+ */
+typedef void (*vector_destroy_element_func)(void* elem);
+
+/**
+ * @brief Creates a new, empty vector.
+ *
+ * @param[out] handle Pointer to a handle that will point to the created vector.
+ * @param[in] elem_size Size of a single element, in bytes. Must be greater than 0.
+ * @param[in] alignment Required alignment of the buffer, in bytes. Must be 0 (default
+ *                      `malloc` alignment) or a power of two.
+ * @param[in] func Optional destructor function for elements. Pass NULL if not needed.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` on bad arguments,
+ *         or `DSA_ALLOC_FAILURE` if memory allocation fails.
+ */
+dsa_error_code_t dsa_vector_create(vector_t* handle, const size_t elem_size, const size_t alignment, vector_destroy_element_func func);
+
+/**
+ * @brief Creates a new, empty vector that obtains its memory from @p allocator.
+ *
+ * The allocator is copied into the vector and used for the vector itself and its buffer.
+ * Growing the buffer goes through the allocator's `reallocate` callback unless the
+ * alignment exceeds the allocator's guarantee, in which case the elements are moved manually.
+ *
+ * @param[out] handle Pointer to a handle that will point to the created vector.
+ * @param[in] elem_size Size of a single element, in bytes. Must be greater than 0.
+ * @param[in] alignment Required alignment of the buffer, in bytes. Must be 0 or a power of two.
+ * @param[in] func Optional destructor function for elements. Pass NULL if not needed.
+ * @param[in] allocator Allocator to use, or NULL for the current default allocator.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` on bad arguments or if @p allocator
+ *         lacks a required callback, or `DSA_ALLOC_FAILURE` if memory allocation fails.
+ */
+dsa_error_code_t dsa_vector_create_with_allocator(vector_t* handle, const size_t elem_size, const size_t alignment,
+                                                  vector_destroy_element_func func, const dsa_allocator_t* allocator);
+
+/**
+ * @brief Retrieves a pointer to the vector's contiguous buffer.
+ *
+ * @param[in] handle Vector handle.
+ * @param[out] data Pointer to the first element. Set to NULL if no buffer is allocated yet.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if arguments are invalid.
+ */
+dsa_error_code_t dsa_vector_data(vector_t handle, void** data);
+
+/**
+ * @brief Retrieves a pointer to the element at the given position.
+ *
+ * @param[in] handle Vector handle.
+ * @param[in] index Position of the element. Must be smaller than the vector size.
+ * @param[out] elem Pointer to the element inside the buffer.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if arguments are invalid
+ *         or @p index is out of range.
+ */
+dsa_error_code_t dsa_vector_get_at(vector_t handle, const size_t index, void** elem);
+
+/**
+ * @brief Gets the number of elements in the vector.
+ *
+ * @param[in] handle Vector handle.
+ * @param[out] size Pointer to the variable that will receive the vector size.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` on bad arguments.
+ */
+dsa_error_code_t dsa_vector_get_size(const vector_t handle, size_t* size);
+
+/**
+ * @brief Gets the number of elements the vector can hold without reallocating.
+ *
+ * @param[in] handle Vector handle.
+ * @param[out] capacity Pointer to the variable that will receive the capacity.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` on bad arguments.
+ */
+dsa_error_code_t dsa_vector_get_capacity(const vector_t handle, size_t* capacity);
+
+/**
+ * @brief Checks whether the vector is empty.
+ *
+ * @param[in] handle Vector handle.
+ * @param[out] is_empty Set to true if the vector is empty, false otherwise.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if arguments are invalid.
+ */
+dsa_error_code_t dsa_vector_is_empty(vector_t handle, bool* is_empty);
+
+/**
+ * @brief Ensures the vector can hold at least @p capacity elements without reallocating.
+ *
+ * @param[in] handle Vector handle.
+ * @param[in] capacity Requested capacity, in elements.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` on bad arguments,
+ *         or `DSA_ALLOC_FAILURE` if memory allocation fails.
+ */
+dsa_error_code_t dsa_vector_reserve(vector_t handle, const size_t capacity);
+
+/**
+ * @brief Reduces the capacity of the vector to its size.
+ *
+ * An empty vector releases its buffer.
+ *
+ * @param[in] handle Vector handle.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` on bad arguments,
+ *         or `DSA_ALLOC_FAILURE` if memory allocation fails (the vector is left unchanged).
+ */
+dsa_error_code_t dsa_vector_shrink_to_fit(vector_t handle);
+
+/**
+ * @brief Copies one element to the back of the vector.
+ *
+ * This operation runs in amortized constant time O(1).
+ *
+ * @param[in] handle Vector handle.
+ * @param[in] elem Pointer to `elem_size` bytes to copy. Must not point into the vector's buffer.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` on bad arguments,
+ *         or `DSA_ALLOC_FAILURE` if memory allocation fails.
+ */
+dsa_error_code_t dsa_vector_push_back(vector_t handle, const void* elem);
+
+/**
+ * @brief Copies @p count contiguous elements to the back of the vector.
+ *
+ * The buffer is grown at most once and the elements are copied with a single `memcpy`.
+ *
+ * @param[in] handle Vector handle.
+ * @param[in] elems Pointer to @p count elements of `elem_size` bytes. Must not point into
+ *                  the vector's buffer.
+ * @param[in] count Number of elements to append. Must be greater than 0.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` on bad arguments,
+ *         or `DSA_ALLOC_FAILURE` if memory allocation fails.
+ */
+dsa_error_code_t dsa_vector_append(vector_t handle, const void* elems, const size_t count);
+
+/**
+ * @brief Removes the last element of the vector.
+ *
+ * If a destroy function was provided at creation, it is called on the removed element.
+ *
+ * @param[in] handle Vector handle.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` on bad arguments,
+ *         or `DSA_EMPTY_LIST` if the vector is empty.
+ */
+dsa_error_code_t dsa_vector_pop_back(vector_t handle);
+
+/**
+ * @brief Removes the element at @p index by moving the last element into its place.
+ *
+ * This operation runs in constant time O(1) but does not preserve element order.
+ * If a destroy function was provided at creation, it is called on the removed element.
+ *
+ * @param[in] handle Vector handle.
+ * @param[in] index Position of the element to remove. Must be smaller than the vector size.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` on bad arguments or if @p index is out of range.
+ */
+dsa_error_code_t dsa_vector_swap_remove(vector_t handle, const size_t index);
+
+/**
+ * @brief Removes all elements, calling the destroy function if set.
+ *
+ * The buffer is kept for reuse.
+ *
+ * @param[in] handle Vector handle.
+ * @return `DSA_SUCCESS` on success, `DSA_INVALID_INPUT` if the handle is NULL.
+ */
+dsa_error_code_t dsa_vector_clear(vector_t handle);
+
+/**
+ * @brief Destroys the vector and frees its memory.
+ *
+ * If a destroy function was provided at creation, it will be called for each element.
+ *
+ * @param[in] handle Vector handle to destroy. Safe to call with NULL.
+ */
+void dsa_vector_destroy(vector_t handle);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
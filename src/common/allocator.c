@@ -0,0 +1,150 @@
+#include "dsa/common/allocator.h"
+#include "dsa/common/stats.h"
+
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+static void* _system_allocate(void* ctx, size_t size)
+{
+    (void)ctx;
+    return malloc(size);
+}
+
+static void* _system_reallocate(void* ctx, void* ptr, size_t old_size, size_t new_size)
+{
+    (void)ctx;
+    (void)old_size;
+    return realloc(ptr, new_size);
+}
+
+static void _system_deallocate(void* ctx, void* ptr, size_t size)
+{
+    (void)ctx;
+    (void)size;
+    free(ptr);
+}
+
+static const dsa_allocator_t _system_allocator = {
+    .allocate = _system_allocate,
+    .reallocate = _system_reallocate,
+    .deallocate = _system_deallocate,
+    .ctx = NULL,
+};
+
+static const dsa_allocator_t* _Atomic _default_allocator = &_system_allocator;
+
+const dsa_allocator_t* dsa_allocator_system(void)
+{
+    return &_system_allocator;
+}
+
+const dsa_allocator_t* dsa_allocator_get_default(void)
+{
+    return atomic_load_explicit(&_default_allocator, memory_order_acquire);
+}
+
+dsa_error_code_t dsa_allocator_set_default(const dsa_allocator_t* allocator)
+{
+    if (allocator && (!allocator->allocate || !allocator->deallocate))
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    atomic_store_explicit(&_default_allocator, allocator ? allocator : &_system_allocator, memory_order_release);
+    return DSA_SUCCESS;
+}
+
+void* dsa_allocate(const dsa_allocator_t* allocator, const size_t size)
+{
+    if (size == 0)
+    {
+        return NULL;
+    }
+
+    if (!allocator)
+    {
+        allocator = dsa_allocator_get_default();
+    }
+
+    void* block = allocator->allocate(allocator->ctx, size);
+    if (block)
+    {
+        DSA_STATS_ADD(allocations, 1);
+        DSA_STATS_ADD(allocated_bytes, size);
+    }
+
+    return block;
+}
+
+void* dsa_reallocate(const dsa_allocator_t* allocator, void* ptr, const size_t old_size, const size_t new_size)
+{
+    if (new_size == 0)
+    {
+        return NULL;
+    }
+
+    if (!ptr)
+    {
+        return dsa_allocate(allocator, new_size);
+    }
+
+    if (!allocator)
+    {
+        allocator = dsa_allocator_get_default();
+    }
+
+    void* moved = NULL;
+    if (allocator->reallocate)
+    {
+        moved = allocator->reallocate(allocator->ctx, ptr, old_size, new_size);
+    }
+    else
+    {
+        moved = allocator->allocate(allocator->ctx, new_size);
+        if (moved)
+        {
+            memcpy(moved, ptr, old_size < new_size ? old_size : new_size);
+            allocator->deallocate(allocator->ctx, ptr, old_size);
+        }
+    }
+
+    if (moved)
+    {
+        DSA_STATS_ADD(allocations, 1);
+        DSA_STATS_ADD(allocated_bytes, new_size);
+    }
+
+    return moved;
+}
+
+void dsa_deallocate(const dsa_allocator_t* allocator, void* ptr, const size_t size)
+{
+    if (!ptr)
+    {
+        return;
+    }
+
+    if (!allocator)
+    {
+        allocator = dsa_allocator_get_default();
+    }
+
+    allocator->deallocate(allocator->ctx, ptr, size);
+    DSA_STATS_ADD(deallocations, 1);
+}
+
+bool dsa_allocator_equals(const dsa_allocator_t* first, const dsa_allocator_t* second)
+{
+    if (!first)
+    {
+        first = dsa_allocator_get_default();
+    }
+    if (!second)
+    {
+        second = dsa_allocator_get_default();
+    }
+
+    return first->allocate == second->allocate && first->reallocate == second->reallocate &&
+           first->deallocate == second->deallocate && first->ctx == second->ctx;
+}
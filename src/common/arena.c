@@ -0,0 +1,350 @@
+#if defined(__linux__)
+    #define _GNU_SOURCE
+#endif
+
+#include "dsa/common/arena.h"
+
+#include <stdalign.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__linux__)
+    #include <sys/mman.h>
+#endif
+
+#define _ARENA_DEFAULT_CHUNK ((size_t)64 * 1024)
+#define _ARENA_HUGE_PAGE ((size_t)2 * 1024 * 1024)
+
+// Offsets are measured from the start of the chunk, so the header is skipped by
+// starting every chunk at _ARENA_HEADER.
+typedef struct arena_chunk
+{
+    struct arena_chunk* next;
+    size_t size;
+    bool mapped;
+} _arena_chunk_t;
+
+#define _ARENA_HEADER ((sizeof(_arena_chunk_t) + alignof(max_align_t) - 1) & ~(alignof(max_align_t) - 1))
+
+struct dsa_arena
+{
+    _arena_chunk_t* first;
+    _arena_chunk_t* current;
+    size_t offset;
+    size_t chunk_size;
+    size_t capacity;
+    bool huge_pages;
+};
+
+static void* _bump(_arena_chunk_t* chunk, size_t* offset, const size_t size, const size_t alignment)
+{
+    const uintptr_t base = (uintptr_t)chunk;
+    const uintptr_t top = base + *offset;
+    const size_t begin = (size_t)(((top + alignment - 1) & ~(uintptr_t)(alignment - 1)) - base);
+
+    if (begin > chunk->size || size > chunk->size - begin)
+    {
+        return NULL;
+    }
+
+    *offset = begin + size;
+    return (unsigned char*)chunk + begin;
+}
+
+static _arena_chunk_t* _map_chunk(size_t* size)
+{
+#if defined(__linux__)
+    if (*size > SIZE_MAX - 2 * _ARENA_HUGE_PAGE)
+    {
+        return NULL;
+    }
+    *size = (*size + _ARENA_HUGE_PAGE - 1) & ~(_ARENA_HUGE_PAGE - 1);
+
+    // Map one extra huge page and trim the ends, so that the chunk starts on a huge page boundary.
+    unsigned char* raw = mmap(NULL, *size + _ARENA_HUGE_PAGE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED)
+    {
+        return NULL;
+    }
+
+    const size_t head = (size_t)((((uintptr_t)raw + _ARENA_HUGE_PAGE - 1) & ~(uintptr_t)(_ARENA_HUGE_PAGE - 1)) - (uintptr_t)raw);
+    if (head > 0)
+    {
+        munmap(raw, head);
+    }
+    if (head < _ARENA_HUGE_PAGE)
+    {
+        munmap(raw + head + *size, _ARENA_HUGE_PAGE - head);
+    }
+
+    #if defined(MADV_HUGEPAGE)
+    madvise(raw + head, *size, MADV_HUGEPAGE);
+    #endif
+
+    return (_arena_chunk_t*)(void*)(raw + head);
+#else
+    (void)size;
+    return NULL;
+#endif
+}
+
+static void _release_chunk(_arena_chunk_t* chunk)
+{
+#if defined(__linux__)
+    if (chunk->mapped)
+    {
+        munmap(chunk, chunk->size);
+        return;
+    }
+#endif
+    free(chunk);
+}
+
+// Links a new chunk of at least `min_size` bytes after the current one, ahead of any chunks
+// kept from before a rewind, and makes it current.
+static bool _add_chunk(struct dsa_arena* arena, const size_t min_size)
+{
+    size_t size = arena->chunk_size > min_size ? arena->chunk_size : min_size;
+
+    bool mapped = false;
+    _arena_chunk_t* chunk = NULL;
+    if (arena->huge_pages)
+    {
+        chunk = _map_chunk(&size);
+        mapped = (chunk != NULL);
+    }
+    if (!chunk)
+    {
+        chunk = malloc(size);
+        if (!chunk)
+        {
+            return false;
+        }
+    }
+
+    chunk->size = size;
+    chunk->mapped = mapped;
+
+    if (arena->current)
+    {
+        chunk->next = arena->current->next;
+        arena->current->next = chunk;
+    }
+    else
+    {
+        chunk->next = arena->first;
+        arena->first = chunk;
+    }
+
+    arena->current = chunk;
+    arena->offset = _ARENA_HEADER;
+    arena->capacity += size;
+
+    return true;
+}
+
+static void* _arena_allocate(void* ctx, size_t size)
+{
+    void* ptr = NULL;
+    return dsa_arena_alloc(ctx, size, 0, &ptr) == DSA_SUCCESS ? ptr : NULL;
+}
+
+// Only the most recent block can be given back, by moving the offset down to it.
+static bool _is_last_block(const struct dsa_arena* arena, const void* ptr, const size_t size)
+{
+    const uintptr_t base = (uintptr_t)arena->current;
+    const uintptr_t address = (uintptr_t)ptr;
+    return arena->current && address >= base + _ARENA_HEADER && address + size == base + arena->offset;
+}
+
+static void _arena_deallocate(void* ctx, void* ptr, size_t size)
+{
+    struct dsa_arena* arena = ctx;
+    if (_is_last_block(arena, ptr, size))
+    {
+        arena->offset = (size_t)((uintptr_t)ptr - (uintptr_t)arena->current);
+    }
+}
+
+static void* _arena_reallocate(void* ctx, void* ptr, size_t old_size, size_t new_size)
+{
+    struct dsa_arena* arena = ctx;
+
+    if (_is_last_block(arena, ptr, old_size))
+    {
+        const size_t begin = (size_t)((uintptr_t)ptr - (uintptr_t)arena->current);
+        if (new_size <= arena->current->size - begin)
+        {
+            arena->offset = begin + new_size;
+            return ptr;
+        }
+    }
+
+    void* moved = _arena_allocate(arena, new_size);
+    if (moved)
+    {
+        memcpy(moved, ptr, old_size < new_size ? old_size : new_size);
+    }
+
+    return moved;
+}
+
+dsa_error_code_t dsa_arena_create(dsa_arena_t* handle, const dsa_arena_options_t* options)
+{
+    if (!handle)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    *handle = malloc(sizeof(**handle));
+
+    if (!(*handle))
+    {
+        return DSA_ALLOC_FAILURE;
+    }
+
+    (*handle)->first = NULL;
+    (*handle)->current = NULL;
+    (*handle)->offset = 0;
+    (*handle)->chunk_size = (options && options->chunk_size) ? options->chunk_size : _ARENA_DEFAULT_CHUNK;
+    (*handle)->capacity = 0;
+    (*handle)->huge_pages = options ? options->huge_pages : false;
+
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_arena_alloc(dsa_arena_t handle, const size_t size, const size_t alignment, void** ptr)
+{
+    if (!handle || size == 0 || (alignment & (alignment - 1)) != 0 || !ptr)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    const size_t align = alignment ? alignment : alignof(max_align_t);
+
+    if (handle->current)
+    {
+        *ptr = _bump(handle->current, &handle->offset, size, align);
+        if (*ptr)
+        {
+            return DSA_SUCCESS;
+        }
+
+        // Reuse the chunk following the current one if it was kept by a rewind or reset.
+        _arena_chunk_t* next = handle->current->next;
+        if (next)
+        {
+            size_t offset = _ARENA_HEADER;
+            *ptr = _bump(next, &offset, size, align);
+            if (*ptr)
+            {
+                handle->current = next;
+                handle->offset = offset;
+                return DSA_SUCCESS;
+            }
+        }
+    }
+
+    if (size > SIZE_MAX - _ARENA_HEADER - align)
+    {
+        return DSA_ALLOC_FAILURE;
+    }
+
+    if (!_add_chunk(handle, _ARENA_HEADER + size + align - 1))
+    {
+        return DSA_ALLOC_FAILURE;
+    }
+
+    *ptr = _bump(handle->current, &handle->offset, size, align);
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_arena_mark(dsa_arena_t handle, dsa_arena_mark_t* mark)
+{
+    if (!handle || !mark)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    mark->chunk = handle->current;
+    mark->offset = handle->offset;
+
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_arena_rewind(dsa_arena_t handle, const dsa_arena_mark_t* mark)
+{
+    if (!handle || !mark)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    // A mark taken before the first allocation refers to no chunk.
+    if (!mark->chunk)
+    {
+        return dsa_arena_reset(handle);
+    }
+
+    handle->current = mark->chunk;
+    handle->offset = mark->offset;
+
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_arena_reset(dsa_arena_t handle)
+{
+    if (!handle)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    handle->current = handle->first;
+    handle->offset = _ARENA_HEADER;
+
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_arena_get_capacity(dsa_arena_t handle, size_t* capacity)
+{
+    if (!handle || !capacity)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    *capacity = handle->capacity;
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_arena_get_allocator(dsa_arena_t handle, dsa_allocator_t* allocator)
+{
+    if (!handle || !allocator)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    allocator->allocate = _arena_allocate;
+    allocator->reallocate = _arena_reallocate;
+    allocator->deallocate = _arena_deallocate;
+    allocator->ctx = handle;
+
+    return DSA_SUCCESS;
+}
+
+void dsa_arena_destroy(dsa_arena_t handle)
+{
+    if (!handle)
+    {
+        return;
+    }
+
+    _arena_chunk_t* chunk = handle->first;
+    while (chunk)
+    {
+        _arena_chunk_t* next = chunk->next;
+        _release_chunk(chunk);
+        chunk = next;
+    }
+
+    free(handle);
+}
@@ -0,0 +1,193 @@
+#include "dsa/common/cpu.h"
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #define _CPU_MSVC_X86 1
+    #include <immintrin.h>
+    #include <intrin.h>
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #define _CPU_GNU_X86 1
+#endif
+
+#define _CPU_LEVEL_COUNT 5
+#define _CPU_UNKNOWN (-1)
+
+static const char* const _level_names[_CPU_LEVEL_COUNT] = { "scalar", "sse2", "sse4.2", "avx2", "avx512" };
+
+static _Atomic int _detected_level = _CPU_UNKNOWN;
+static _Atomic int _active_level = _CPU_UNKNOWN;
+
+#if defined(_CPU_MSVC_X86)
+
+static dsa_cpu_level_t _query_level(void)
+{
+    int regs[4] = { 0 };
+    __cpuid(regs, 0);
+    const int max_leaf = regs[0];
+
+    __cpuid(regs, 1);
+    const unsigned ecx1 = (unsigned)regs[2];
+    const unsigned edx1 = (unsigned)regs[3];
+
+    if (!(edx1 & (1u << 26)))
+    {
+        return DSA_CPU_LEVEL_SCALAR;
+    }
+    if (!(ecx1 & (1u << 20)))
+    {
+        return DSA_CPU_LEVEL_SSE2;
+    }
+
+    // AVX state must be enabled by the operating system (OSXSAVE and XCR0 bits 1-2).
+    if (!(ecx1 & (1u << 27)) || !(ecx1 & (1u << 28)) || (_xgetbv(0) & 0x6) != 0x6 || max_leaf < 7)
+    {
+        return DSA_CPU_LEVEL_SSE4_2;
+    }
+
+    __cpuidex(regs, 7, 0);
+    const unsigned ebx7 = (unsigned)regs[1];
+    if (!(ebx7 & (1u << 5)))
+    {
+        return DSA_CPU_LEVEL_SSE4_2;
+    }
+
+    // AVX-512 F, BW and VL, plus opmask and ZMM state (XCR0 bits 5-7).
+    const unsigned avx512_bits = (1u << 16) | (1u << 30) | (1u << 31);
+    if ((ebx7 & avx512_bits) != avx512_bits || (_xgetbv(0) & 0xE6) != 0xE6)
+    {
+        return DSA_CPU_LEVEL_AVX2;
+    }
+
+    return DSA_CPU_LEVEL_AVX512;
+}
+
+#elif defined(_CPU_GNU_X86)
+
+static dsa_cpu_level_t _query_level(void)
+{
+    // The compiler runtime also checks that the operating system saves the AVX registers.
+    __builtin_cpu_init();
+
+    if (!__builtin_cpu_supports("sse2"))
+    {
+        return DSA_CPU_LEVEL_SCALAR;
+    }
+    if (!__builtin_cpu_supports("sse4.2"))
+    {
+        return DSA_CPU_LEVEL_SSE2;
+    }
+    if (!__builtin_cpu_supports("avx2"))
+    {
+        return DSA_CPU_LEVEL_SSE4_2;
+    }
+    if (!__builtin_cpu_supports("avx512f") || !__builtin_cpu_supports("avx512bw") || !__builtin_cpu_supports("avx512vl"))
+    {
+        return DSA_CPU_LEVEL_AVX2;
+    }
+
+    return DSA_CPU_LEVEL_AVX512;
+}
+
+#else
+
+static dsa_cpu_level_t _query_level(void)
+{
+    return DSA_CPU_LEVEL_SCALAR;
+}
+
+#endif
+
+// Returns the level named by the DSA_CPU_LEVEL environment variable, or _CPU_UNKNOWN.
+static int _environment_level(void)
+{
+    char value[16] = { 0 };
+
+#if defined(_MSC_VER)
+    size_t length = 0;
+    if (getenv_s(&length, value, sizeof(value), "DSA_CPU_LEVEL") != 0 || length == 0)
+    {
+        return _CPU_UNKNOWN;
+    }
+#else
+    const char* env = getenv("DSA_CPU_LEVEL");
+    if (!env || strlen(env) >= sizeof(value))
+    {
+        return _CPU_UNKNOWN;
+    }
+    strcpy(value, env);
+#endif
+
+    for (int i = 0; i < _CPU_LEVEL_COUNT; i++)
+    {
+        if (strcmp(value, _level_names[i]) == 0)
+        {
+            return i;
+        }
+    }
+
+    return _CPU_UNKNOWN;
+}
+
+dsa_cpu_level_t dsa_cpu_detect(void)
+{
+    int level = atomic_load_explicit(&_detected_level, memory_order_relaxed);
+
+    // Detection is idempotent, so threads racing here all store the same value.
+    if (level == _CPU_UNKNOWN)
+    {
+        level = (int)_query_level();
+        atomic_store_explicit(&_detected_level, level, memory_order_relaxed);
+    }
+
+    return (dsa_cpu_level_t)level;
+}
+
+dsa_cpu_level_t dsa_cpu_get_level(void)
+{
+    int level = atomic_load_explicit(&_active_level, memory_order_relaxed);
+
+    if (level == _CPU_UNKNOWN)
+    {
+        level = (int)dsa_cpu_detect();
+
+        const int requested = _environment_level();
+        if (requested != _CPU_UNKNOWN && requested < level)
+        {
+            level = requested;
+        }
+
+        // A level forced concurrently takes precedence over the initial one.
+        int expected = _CPU_UNKNOWN;
+        if (!atomic_compare_exchange_strong_explicit(&_active_level, &expected, level, memory_order_relaxed, memory_order_relaxed))
+        {
+            level = expected;
+        }
+    }
+
+    return (dsa_cpu_level_t)level;
+}
+
+dsa_error_code_t dsa_cpu_force_level(const dsa_cpu_level_t level)
+{
+    if ((int)level < 0 || (int)level >= _CPU_LEVEL_COUNT || level > dsa_cpu_detect())
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    atomic_store_explicit(&_active_level, (int)level, memory_order_relaxed);
+    return DSA_SUCCESS;
+}
+
+const char* dsa_cpu_level_name(const dsa_cpu_level_t level)
+{
+    if ((int)level < 0 || (int)level >= _CPU_LEVEL_COUNT)
+    {
+        return "unknown";
+    }
+
+    return _level_names[level];
+}
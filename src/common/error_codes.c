@@ -12,6 +12,8 @@ const char* dsa_strerror(const dsa_error_code_t code)
             return "Allocation failure";
         case DSA_EMPTY_LIST:
             return "Empty List";
+        case DSA_FULL:
+            return "Full";
         default:
             return "Unknown error";
     }
@@ -0,0 +1,533 @@
+#include "dsa/common/executor.h"
+#include "dsa/common/thread.h"
+
+#include <stdatomic.h>
+#include <stdlib.h>
+
+#if defined(_MSC_VER)
+    #define _THREAD_LOCAL __declspec(thread)
+#else
+    #define _THREAD_LOCAL _Thread_local
+#endif
+
+// With the automatic grain every worker gets about this many pieces of a parallel_for,
+// enough for idle workers to find something to steal when the work is uneven.
+#define _EXECUTOR_PIECES_PER_WORKER 8
+
+typedef struct executor_task
+{
+    dsa_task_func func;
+    void* arg;
+    dsa_task_group_t* group;
+    struct executor_task* prev;
+    struct executor_task* next;
+} _executor_task_t;
+
+// The owner pushes and pops at the back, thieves take the oldest task from the front.
+typedef struct
+{
+    dsa_mutex_t lock;
+    _executor_task_t* front;
+    _executor_task_t* back;
+} _executor_deque_t;
+
+typedef struct
+{
+    struct dsa_executor* executor;
+    size_t index;
+    _executor_deque_t deque;
+    dsa_thread_t thread;
+} _executor_worker_t;
+
+struct dsa_executor
+{
+    _executor_worker_t* workers;
+    size_t num_workers;
+    size_t started;
+    bool pin_threads;
+    bool run_on_caller;
+    _Atomic size_t queued;
+    _Atomic size_t sleeping;
+    _Atomic size_t next_victim;
+    dsa_mutex_t sleep_lock;
+    dsa_cond_t wake;
+    bool stopping;
+};
+
+static _THREAD_LOCAL _executor_worker_t* _current_worker = NULL;
+
+static struct dsa_executor* _Atomic _default_executor = NULL;
+
+static void _push_back(_executor_deque_t* deque, _executor_task_t* task)
+{
+    dsa_mutex_lock(deque->lock);
+
+    task->next = NULL;
+    task->prev = deque->back;
+    if (deque->back)
+    {
+        deque->back->next = task;
+    }
+    else
+    {
+        deque->front = task;
+    }
+    deque->back = task;
+
+    dsa_mutex_unlock(deque->lock);
+}
+
+static _executor_task_t* _pop_back(_executor_deque_t* deque)
+{
+    dsa_mutex_lock(deque->lock);
+
+    _executor_task_t* task = deque->back;
+    if (task)
+    {
+        deque->back = task->prev;
+        if (deque->back)
+        {
+            deque->back->next = NULL;
+        }
+        else
+        {
+            deque->front = NULL;
+        }
+    }
+
+    dsa_mutex_unlock(deque->lock);
+    return task;
+}
+
+static _executor_task_t* _pop_front(_executor_deque_t* deque)
+{
+    dsa_mutex_lock(deque->lock);
+
+    _executor_task_t* task = deque->front;
+    if (task)
+    {
+        deque->front = task->next;
+        if (deque->front)
+        {
+            deque->front->prev = NULL;
+        }
+        else
+        {
+            deque->back = NULL;
+        }
+    }
+
+    dsa_mutex_unlock(deque->lock);
+    return task;
+}
+
+static _executor_worker_t* _worker_of(struct dsa_executor* executor)
+{
+    return (_current_worker && _current_worker->executor == executor) ? _current_worker : NULL;
+}
+
+// Takes the newest task of `self` if it has any, otherwise steals the oldest task of
+// another worker. `self` is NULL for threads that do not belong to the executor.
+static _executor_task_t* _find_task(struct dsa_executor* executor, _executor_worker_t* self)
+{
+    if (atomic_load_explicit(&executor->queued, memory_order_acquire) == 0)
+    {
+        return NULL;
+    }
+
+    _executor_task_t* task = self ? _pop_back(&self->deque) : NULL;
+
+    const size_t start = self ? self->index + 1 : atomic_fetch_add_explicit(&executor->next_victim, 1, memory_order_relaxed);
+    for (size_t i = 0; !task && i < executor->num_workers; i++)
+    {
+        _executor_worker_t* victim = &executor->workers[(start + i) % executor->num_workers];
+        if (victim != self)
+        {
+            task = _pop_front(&victim->deque);
+        }
+    }
+
+    if (task)
+    {
+        atomic_fetch_sub_explicit(&executor->queued, 1, memory_order_relaxed);
+    }
+
+    return task;
+}
+
+static void _run_task(_executor_task_t* task)
+{
+    const dsa_task_func func = task->func;
+    void* arg = task->arg;
+    dsa_task_group_t* group = task->group;
+    free(task);
+
+    func(arg);
+
+    // The waiting thread may release the group as soon as the count drops to zero.
+    atomic_fetch_sub_explicit(&group->pending, 1, memory_order_release);
+}
+
+static void _worker_main(void* arg)
+{
+    _executor_worker_t* self = arg;
+    struct dsa_executor* executor = self->executor;
+
+    _current_worker = self;
+    if (executor->pin_threads)
+    {
+        dsa_thread_pin_current(self->index);
+    }
+
+    for (;;)
+    {
+        _executor_task_t* task = _find_task(executor, self);
+        if (task)
+        {
+            _run_task(task);
+            continue;
+        }
+
+        // Announcing the sleeper before checking the queue pairs with the spawning thread
+        // counting the task before checking for sleepers, so that no wakeup is lost.
+        dsa_mutex_lock(executor->sleep_lock);
+        atomic_fetch_add(&executor->sleeping, 1);
+        while (atomic_load(&executor->queued) == 0 && !executor->stopping)
+        {
+            dsa_cond_wait(executor->wake, executor->sleep_lock);
+        }
+        atomic_fetch_sub(&executor->sleeping, 1);
+        const bool stopping = executor->stopping;
+        dsa_mutex_unlock(executor->sleep_lock);
+
+        if (stopping)
+        {
+            return;
+        }
+    }
+}
+
+static void _release_executor(struct dsa_executor* executor)
+{
+    if (executor->started > 0)
+    {
+        dsa_mutex_lock(executor->sleep_lock);
+        executor->stopping = true;
+        dsa_cond_broadcast(executor->wake);
+        dsa_mutex_unlock(executor->sleep_lock);
+
+        for (size_t i = 0; i < executor->started; i++)
+        {
+            dsa_thread_join(executor->workers[i].thread);
+        }
+    }
+
+    for (size_t i = 0; i < executor->num_workers; i++)
+    {
+        _executor_task_t* task = executor->workers[i].deque.front;
+        while (task)
+        {
+            _executor_task_t* next = task->next;
+            free(task);
+            task = next;
+        }
+        dsa_mutex_destroy(executor->workers[i].deque.lock);
+    }
+
+    dsa_cond_destroy(executor->wake);
+    dsa_mutex_destroy(executor->sleep_lock);
+    free(executor->workers);
+    free(executor);
+}
+
+dsa_error_code_t dsa_executor_create(dsa_executor_t* handle, const dsa_executor_options_t* options)
+{
+    if (!handle)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    const dsa_executor_options_t defaults = { 0 };
+    if (!options)
+    {
+        options = &defaults;
+    }
+
+    struct dsa_executor* executor = calloc(1, sizeof(*executor));
+    if (!executor)
+    {
+        return DSA_ALLOC_FAILURE;
+    }
+
+    executor->pin_threads = options->pin_threads;
+    executor->run_on_caller = options->run_on_caller;
+    atomic_init(&executor->queued, 0);
+    atomic_init(&executor->sleeping, 0);
+    atomic_init(&executor->next_victim, 0);
+
+    if (executor->run_on_caller)
+    {
+        *handle = executor;
+        return DSA_SUCCESS;
+    }
+
+    const size_t num_workers = options->num_threads ? options->num_threads : dsa_thread_hardware_concurrency();
+    executor->workers = calloc(num_workers, sizeof(*executor->workers));
+    if (!executor->workers || dsa_mutex_create(&executor->sleep_lock) != DSA_SUCCESS ||
+        dsa_cond_create(&executor->wake) != DSA_SUCCESS)
+    {
+        _release_executor(executor);
+        return DSA_ALLOC_FAILURE;
+    }
+
+    for (size_t i = 0; i < num_workers; i++)
+    {
+        executor->workers[i].executor = executor;
+        executor->workers[i].index = i;
+        if (dsa_mutex_create(&executor->workers[i].deque.lock) != DSA_SUCCESS)
+        {
+            _release_executor(executor);
+            return DSA_ALLOC_FAILURE;
+        }
+        ++executor->num_workers;
+    }
+
+    for (size_t i = 0; i < num_workers; i++)
+    {
+        if (dsa_thread_create(&executor->workers[i].thread, _worker_main, &executor->workers[i]) != DSA_SUCCESS)
+        {
+            _release_executor(executor);
+            return DSA_ALLOC_FAILURE;
+        }
+        ++executor->started;
+    }
+
+    *handle = executor;
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_executor_get_default(dsa_executor_t* handle)
+{
+    if (!handle)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    struct dsa_executor* executor = atomic_load_explicit(&_default_executor, memory_order_acquire);
+    if (!executor)
+    {
+        const dsa_error_code_t result = dsa_executor_create(&executor, NULL);
+        if (result != DSA_SUCCESS)
+        {
+            return result;
+        }
+
+        // Several threads may race to create the default executor; only one of them publishes it.
+        struct dsa_executor* expected = NULL;
+        if (!atomic_compare_exchange_strong_explicit(&_default_executor, &expected, executor, memory_order_acq_rel,
+                                                     memory_order_acquire))
+        {
+            dsa_executor_destroy(executor);
+            executor = expected;
+        }
+    }
+
+    *handle = executor;
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_executor_get_thread_count(dsa_executor_t handle, size_t* num_threads)
+{
+    if (!handle || !num_threads)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    *num_threads = handle->started;
+    return DSA_SUCCESS;
+}
+
+void dsa_executor_destroy(dsa_executor_t handle)
+{
+    if (!handle)
+    {
+        return;
+    }
+
+    _release_executor(handle);
+}
+
+dsa_error_code_t dsa_task_group_init(dsa_task_group_t* group, dsa_executor_t executor)
+{
+    if (!group || !executor)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    group->executor = executor;
+    atomic_init(&group->pending, 0);
+
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_task_group_run(dsa_task_group_t* group, dsa_task_func func, void* arg)
+{
+    if (!group || !func)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    struct dsa_executor* executor = group->executor;
+
+    _executor_task_t* task = executor->run_on_caller ? NULL : malloc(sizeof(*task));
+    if (!task)
+    {
+        func(arg);
+        return DSA_SUCCESS;
+    }
+
+    task->func = func;
+    task->arg = arg;
+    task->group = group;
+
+    // Tasks spawned by a worker stay with it; other threads spread theirs over all workers.
+    _executor_worker_t* target = _worker_of(executor);
+    if (!target)
+    {
+        const size_t victim = atomic_fetch_add_explicit(&executor->next_victim, 1, memory_order_relaxed);
+        target = &executor->workers[victim % executor->num_workers];
+    }
+
+    atomic_fetch_add_explicit(&group->pending, 1, memory_order_relaxed);
+    atomic_fetch_add(&executor->queued, 1);
+    _push_back(&target->deque, task);
+
+    if (atomic_load(&executor->sleeping) > 0)
+    {
+        dsa_mutex_lock(executor->sleep_lock);
+        dsa_cond_signal(executor->wake);
+        dsa_mutex_unlock(executor->sleep_lock);
+    }
+
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_task_group_wait(dsa_task_group_t* group)
+{
+    if (!group)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    struct dsa_executor* executor = group->executor;
+    _executor_worker_t* self = _worker_of(executor);
+
+    while (atomic_load_explicit(&group->pending, memory_order_acquire) > 0)
+    {
+        _executor_task_t* task = _find_task(executor, self);
+        if (task)
+        {
+            _run_task(task);
+        }
+        else
+        {
+            dsa_thread_yield();
+        }
+    }
+
+    return DSA_SUCCESS;
+}
+
+typedef struct
+{
+    dsa_task_group_t* group;
+    size_t begin;
+    size_t end;
+    size_t grain;
+    dsa_range_func body;
+    void* ctx;
+} _executor_range_t;
+
+static void _run_range(_executor_range_t* range);
+
+static void _range_task(void* arg)
+{
+    _executor_range_t* range = arg;
+    _run_range(range);
+    free(range);
+}
+
+static void _run_range(_executor_range_t* range)
+{
+    // Keep the left half and hand the right one out, so that thieves take the largest pieces.
+    while (range->end - range->begin > range->grain)
+    {
+        _executor_range_t* right = malloc(sizeof(*right));
+        if (!right)
+        {
+            break;
+        }
+
+        const size_t middle = range->begin + (range->end - range->begin) / 2;
+        *right = *range;
+        right->begin = middle;
+        range->end = middle;
+
+        dsa_task_group_run(range->group, _range_task, right);
+    }
+
+    range->body(range->begin, range->end, range->ctx);
+}
+
+dsa_error_code_t dsa_executor_parallel_for(dsa_executor_t handle, const size_t count, const size_t grain, dsa_range_func body,
+                                           void* ctx)
+{
+    if (count == 0 || !body)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    if (!handle)
+    {
+        const dsa_error_code_t result = dsa_executor_get_default(&handle);
+        if (result != DSA_SUCCESS)
+        {
+            return result;
+        }
+    }
+
+    size_t piece = grain;
+    if (piece == 0)
+    {
+        const size_t num_workers = handle->started ? handle->started : 1;
+        piece = count / (num_workers * _EXECUTOR_PIECES_PER_WORKER);
+        if (piece == 0)
+        {
+            piece = 1;
+        }
+    }
+
+    if (handle->run_on_caller)
+    {
+        for (size_t begin = 0; begin < count; begin += piece)
+        {
+            body(begin, (count - begin < piece) ? count : begin + piece, ctx);
+        }
+        return DSA_SUCCESS;
+    }
+
+    dsa_task_group_t group;
+    dsa_task_group_init(&group, handle);
+
+    _executor_range_t range = {
+        .group = &group,
+        .begin = 0,
+        .end = count,
+        .grain = piece,
+        .body = body,
+        .ctx = ctx,
+    };
+    _run_range(&range);
+
+    return dsa_task_group_wait(&group);
+}
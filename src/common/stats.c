@@ -0,0 +1,43 @@
+#include "dsa/common/stats.h"
+
+#if defined(DSA_ENABLE_STATS)
+
+    #if defined(_MSC_VER)
+__declspec(thread) dsa_stats_t dsa_stats_thread_counters;
+    #else
+_Thread_local dsa_stats_t dsa_stats_thread_counters;
+    #endif
+
+#endif
+
+bool dsa_stats_enabled(void)
+{
+#if defined(DSA_ENABLE_STATS)
+    return true;
+#else
+    return false;
+#endif
+}
+
+dsa_error_code_t dsa_stats_snapshot(dsa_stats_t* stats)
+{
+    if (!stats)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+#if defined(DSA_ENABLE_STATS)
+    *stats = dsa_stats_thread_counters;
+#else
+    *stats = (dsa_stats_t){ 0 };
+#endif
+
+    return DSA_SUCCESS;
+}
+
+void dsa_stats_reset(void)
+{
+#if defined(DSA_ENABLE_STATS)
+    dsa_stats_thread_counters = (dsa_stats_t){ 0 };
+#endif
+}
@@ -0,0 +1,280 @@
+#if defined(__linux__)
+    #define _GNU_SOURCE
+#elif !defined(_WIN32)
+    #define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "dsa/common/thread.h"
+
+#include <stdlib.h>
+
+#if defined(_WIN32)
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+#else
+    #include <pthread.h>
+    #include <sched.h>
+    #include <unistd.h>
+#endif
+
+struct dsa_mutex
+{
+#if defined(_WIN32)
+    SRWLOCK lock;
+#else
+    pthread_mutex_t lock;
+#endif
+};
+
+struct dsa_cond
+{
+#if defined(_WIN32)
+    CONDITION_VARIABLE cond;
+#else
+    pthread_cond_t cond;
+#endif
+};
+
+struct dsa_thread
+{
+#if defined(_WIN32)
+    HANDLE thread;
+#else
+    pthread_t thread;
+#endif
+    dsa_thread_func func;
+    void* arg;
+};
+
+#if defined(_WIN32)
+static DWORD WINAPI _thread_main(LPVOID param)
+{
+    struct dsa_thread* thread = param;
+    thread->func(thread->arg);
+    return 0;
+}
+#else
+static void* _thread_main(void* param)
+{
+    struct dsa_thread* thread = param;
+    thread->func(thread->arg);
+    return NULL;
+}
+#endif
+
+dsa_error_code_t dsa_thread_create(dsa_thread_t* handle, dsa_thread_func func, void* arg)
+{
+    if (!handle || !func)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    struct dsa_thread* thread = malloc(sizeof(*thread));
+    if (!thread)
+    {
+        return DSA_ALLOC_FAILURE;
+    }
+
+    thread->func = func;
+    thread->arg = arg;
+
+#if defined(_WIN32)
+    thread->thread = CreateThread(NULL, 0, _thread_main, thread, 0, NULL);
+    if (!thread->thread)
+#else
+    if (pthread_create(&thread->thread, NULL, _thread_main, thread) != 0)
+#endif
+    {
+        free(thread);
+        return DSA_ALLOC_FAILURE;
+    }
+
+    *handle = thread;
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_thread_join(dsa_thread_t handle)
+{
+    if (!handle)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+#if defined(_WIN32)
+    WaitForSingleObject(handle->thread, INFINITE);
+    CloseHandle(handle->thread);
+#else
+    pthread_join(handle->thread, NULL);
+#endif
+
+    free(handle);
+    return DSA_SUCCESS;
+}
+
+size_t dsa_thread_hardware_concurrency(void)
+{
+#if defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    const long count = (long)info.dwNumberOfProcessors;
+#else
+    const long count = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+
+    return count > 0 ? (size_t)count : 1;
+}
+
+void dsa_thread_yield(void)
+{
+#if defined(_WIN32)
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
+
+dsa_error_code_t dsa_thread_pin_current(const size_t cpu)
+{
+    const size_t target = cpu % dsa_thread_hardware_concurrency();
+
+#if defined(_WIN32)
+    if (target >= sizeof(DWORD_PTR) * 8)
+    {
+        return DSA_INVALID_INPUT;
+    }
+    return SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << target) ? DSA_SUCCESS : DSA_INVALID_INPUT;
+#elif defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(target, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0 ? DSA_SUCCESS : DSA_INVALID_INPUT;
+#else
+    (void)target;
+    return DSA_SUCCESS;
+#endif
+}
+
+dsa_error_code_t dsa_mutex_create(dsa_mutex_t* handle)
+{
+    if (!handle)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    struct dsa_mutex* mutex = malloc(sizeof(*mutex));
+    if (!mutex)
+    {
+        return DSA_ALLOC_FAILURE;
+    }
+
+#if defined(_WIN32)
+    InitializeSRWLock(&mutex->lock);
+#else
+    if (pthread_mutex_init(&mutex->lock, NULL) != 0)
+    {
+        free(mutex);
+        return DSA_ALLOC_FAILURE;
+    }
+#endif
+
+    *handle = mutex;
+    return DSA_SUCCESS;
+}
+
+void dsa_mutex_lock(dsa_mutex_t handle)
+{
+#if defined(_WIN32)
+    AcquireSRWLockExclusive(&handle->lock);
+#else
+    pthread_mutex_lock(&handle->lock);
+#endif
+}
+
+void dsa_mutex_unlock(dsa_mutex_t handle)
+{
+#if defined(_WIN32)
+    ReleaseSRWLockExclusive(&handle->lock);
+#else
+    pthread_mutex_unlock(&handle->lock);
+#endif
+}
+
+void dsa_mutex_destroy(dsa_mutex_t handle)
+{
+    if (!handle)
+    {
+        return;
+    }
+
+#if !defined(_WIN32)
+    pthread_mutex_destroy(&handle->lock);
+#endif
+    free(handle);
+}
+
+dsa_error_code_t dsa_cond_create(dsa_cond_t* handle)
+{
+    if (!handle)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    struct dsa_cond* cond = malloc(sizeof(*cond));
+    if (!cond)
+    {
+        return DSA_ALLOC_FAILURE;
+    }
+
+#if defined(_WIN32)
+    InitializeConditionVariable(&cond->cond);
+#else
+    if (pthread_cond_init(&cond->cond, NULL) != 0)
+    {
+        free(cond);
+        return DSA_ALLOC_FAILURE;
+    }
+#endif
+
+    *handle = cond;
+    return DSA_SUCCESS;
+}
+
+void dsa_cond_wait(dsa_cond_t handle, dsa_mutex_t mutex)
+{
+#if defined(_WIN32)
+    SleepConditionVariableSRW(&handle->cond, &mutex->lock, INFINITE, 0);
+#else
+    pthread_cond_wait(&handle->cond, &mutex->lock);
+#endif
+}
+
+void dsa_cond_signal(dsa_cond_t handle)
+{
+#if defined(_WIN32)
+    WakeConditionVariable(&handle->cond);
+#else
+    pthread_cond_signal(&handle->cond);
+#endif
+}
+
+void dsa_cond_broadcast(dsa_cond_t handle)
+{
+#if defined(_WIN32)
+    WakeAllConditionVariable(&handle->cond);
+#else
+    pthread_cond_broadcast(&handle->cond);
+#endif
+}
+
+void dsa_cond_destroy(dsa_cond_t handle)
+{
+    if (!handle)
+    {
+        return;
+    }
+
+#if !defined(_WIN32)
+    pthread_cond_destroy(&handle->cond);
+#endif
+    free(handle);
+}
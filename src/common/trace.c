@@ -0,0 +1,36 @@
+#include "dsa/common/trace.h"
+
+#include <stdatomic.h>
+
+_Atomic(dsa_trace_hook) dsa_trace_active_hook = NULL;
+static void* _Atomic _hook_ctx = NULL;
+
+bool dsa_trace_enabled(void)
+{
+#if defined(DSA_ENABLE_TRACING)
+    return true;
+#else
+    return false;
+#endif
+}
+
+dsa_error_code_t dsa_trace_set_hook(dsa_trace_hook hook, void* ctx)
+{
+    // The context is published first, so a traced call seeing the new hook also sees its context.
+    atomic_store_explicit(&_hook_ctx, ctx, memory_order_relaxed);
+    atomic_store_explicit(&dsa_trace_active_hook, hook, memory_order_release);
+
+    return DSA_SUCCESS;
+}
+
+void dsa_trace_emit(const char* probe, const dsa_trace_phase_t phase, const size_t size, const size_t elem_size)
+{
+    const dsa_trace_hook hook = atomic_load_explicit(&dsa_trace_active_hook, memory_order_acquire);
+    if (!hook)
+    {
+        return;
+    }
+
+    const dsa_trace_event_t event = { probe, phase, size, elem_size };
+    hook(&event, atomic_load_explicit(&_hook_ctx, memory_order_relaxed));
+}
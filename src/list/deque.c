@@ -0,0 +1,311 @@
+#include "dsa/list/deque.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#define _DEQUE_MIN_CAPACITY 8
+
+// The capacity is always zero or a power of two, so positions wrap with a mask.
+struct deque
+{
+    void** buffer;
+    size_t capacity;
+    size_t head;
+    size_t size;
+    slist_destroy_element_func destroy_func;
+    dsa_allocator_t allocator;
+};
+
+static size_t _position(const struct deque* deque, const size_t index)
+{
+    return (deque->head + index) & (deque->capacity - 1);
+}
+
+static dsa_error_code_t _reallocate(struct deque* deque, const size_t capacity)
+{
+    if (capacity > SIZE_MAX / sizeof(void*))
+    {
+        return DSA_ALLOC_FAILURE;
+    }
+
+    void** buffer = dsa_allocate(&deque->allocator, capacity * sizeof(void*));
+    if (!buffer)
+    {
+        return DSA_ALLOC_FAILURE;
+    }
+
+    // Unwrap the elements so that the front lands at index 0.
+    if (deque->size > 0)
+    {
+        const size_t first_part = deque->capacity - deque->head;
+        if (first_part >= deque->size)
+        {
+            memcpy(buffer, deque->buffer + deque->head, deque->size * sizeof(void*));
+        }
+        else
+        {
+            memcpy(buffer, deque->buffer + deque->head, first_part * sizeof(void*));
+            memcpy(buffer + first_part, deque->buffer, (deque->size - first_part) * sizeof(void*));
+        }
+    }
+
+    dsa_deallocate(&deque->allocator, deque->buffer, deque->capacity * sizeof(void*));
+    deque->buffer = buffer;
+    deque->capacity = capacity;
+    deque->head = 0;
+
+    return DSA_SUCCESS;
+}
+
+static dsa_error_code_t _grow_if_full(struct deque* deque)
+{
+    if (deque->size < deque->capacity)
+    {
+        return DSA_SUCCESS;
+    }
+
+    if (deque->capacity > SIZE_MAX / 2)
+    {
+        return DSA_ALLOC_FAILURE;
+    }
+
+    return _reallocate(deque, deque->capacity ? deque->capacity * 2 : _DEQUE_MIN_CAPACITY);
+}
+
+static void _destroy_elements(struct deque* deque)
+{
+    if (!deque->destroy_func)
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < deque->size; i++)
+    {
+        deque->destroy_func(deque->buffer[_position(deque, i)]);
+    }
+}
+
+dsa_error_code_t dsa_deque_create(deque_t* handle, slist_destroy_element_func func)
+{
+    return dsa_deque_create_with_allocator(handle, func, NULL);
+}
+
+dsa_error_code_t dsa_deque_create_with_allocator(deque_t* handle, slist_destroy_element_func func, const dsa_allocator_t* allocator)
+{
+    if (!handle || (allocator && (!allocator->allocate || !allocator->deallocate)))
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    const dsa_allocator_t resolved = allocator ? *allocator : *dsa_allocator_get_default();
+
+    *handle = dsa_allocate(&resolved, sizeof(**handle));
+
+    if (!(*handle))
+    {
+        return DSA_ALLOC_FAILURE;
+    }
+
+    (*handle)->buffer = NULL;
+    (*handle)->capacity = 0;
+    (*handle)->head = 0;
+    (*handle)->size = 0;
+    (*handle)->destroy_func = func;
+    (*handle)->allocator = resolved;
+
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_deque_reserve(deque_t handle, const size_t capacity)
+{
+    if (!handle)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    if (capacity <= handle->capacity)
+    {
+        return DSA_SUCCESS;
+    }
+
+    size_t rounded_capacity = _DEQUE_MIN_CAPACITY;
+    while (rounded_capacity < capacity)
+    {
+        if (rounded_capacity > SIZE_MAX / 2)
+        {
+            return DSA_ALLOC_FAILURE;
+        }
+        rounded_capacity *= 2;
+    }
+
+    return _reallocate(handle, rounded_capacity);
+}
+
+dsa_error_code_t dsa_deque_get_head(deque_t handle, void** head)
+{
+    if (!handle || !head)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    *head = handle->size ? handle->buffer[handle->head] : NULL;
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_deque_get_tail(deque_t handle, void** tail)
+{
+    if (!handle || !tail)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    *tail = handle->size ? handle->buffer[_position(handle, handle->size - 1)] : NULL;
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_deque_get_at(deque_t handle, const size_t index, void** data)
+{
+    if (!handle || !data || index >= handle->size)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    *data = handle->buffer[_position(handle, index)];
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_deque_get_size(const deque_t handle, size_t* size)
+{
+    if (!handle || !size)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    *size = handle->size;
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_deque_is_empty(deque_t handle, bool* is_empty)
+{
+    if (!handle || !is_empty)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    *is_empty = (handle->size == 0);
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_deque_push_front(deque_t handle, void* data)
+{
+    if (!handle || !data)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    const dsa_error_code_t result = _grow_if_full(handle);
+    if (result != DSA_SUCCESS)
+    {
+        return result;
+    }
+
+    handle->head = (handle->head + handle->capacity - 1) & (handle->capacity - 1);
+    handle->buffer[handle->head] = data;
+    ++handle->size;
+
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_deque_push_back(deque_t handle, void* data)
+{
+    if (!handle || !data)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    const dsa_error_code_t result = _grow_if_full(handle);
+    if (result != DSA_SUCCESS)
+    {
+        return result;
+    }
+
+    handle->buffer[_position(handle, handle->size)] = data;
+    ++handle->size;
+
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_deque_pop_front(deque_t handle)
+{
+    if (!handle)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    if (handle->size == 0)
+    {
+        return DSA_EMPTY_LIST;
+    }
+
+    void* data = handle->buffer[handle->head];
+    handle->head = _position(handle, 1);
+    --handle->size;
+
+    if (handle->destroy_func)
+    {
+        handle->destroy_func(data);
+    }
+
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_deque_pop_back(deque_t handle)
+{
+    if (!handle)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    if (handle->size == 0)
+    {
+        return DSA_EMPTY_LIST;
+    }
+
+    void* data = handle->buffer[_position(handle, handle->size - 1)];
+    --handle->size;
+
+    if (handle->destroy_func)
+    {
+        handle->destroy_func(data);
+    }
+
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_deque_clear(deque_t handle)
+{
+    if (!handle)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    _destroy_elements(handle);
+    handle->head = 0;
+    handle->size = 0;
+
+    return DSA_SUCCESS;
+}
+
+void dsa_deque_destroy(deque_t handle)
+{
+    if (!handle)
+    {
+        return;
+    }
+
+    _destroy_elements(handle);
+
+    const dsa_allocator_t allocator = handle->allocator;
+    dsa_deallocate(&allocator, handle->buffer, handle->capacity * sizeof(void*));
+    dsa_deallocate(&allocator, handle, sizeof(*handle));
+}
@@ -0,0 +1,262 @@
+#include "dsa/list/islist.h"
+
+dsa_error_code_t dsa_islist_init(islist_t* list)
+{
+    if (!list)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    list->head = NULL;
+    list->tail = NULL;
+    list->size = 0;
+
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_islist_get_head(const islist_t* list, islist_link_t** head)
+{
+    if (!list || !head)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    *head = list->head;
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_islist_get_tail(const islist_t* list, islist_link_t** tail)
+{
+    if (!list || !tail)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    *tail = list->tail;
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_islist_get_size(const islist_t* list, size_t* size)
+{
+    if (!list || !size)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    *size = list->size;
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_islist_is_empty(const islist_t* list, bool* is_empty)
+{
+    if (!list || !is_empty)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    *is_empty = (list->size == 0);
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_islist_push_front(islist_t* list, islist_link_t* link)
+{
+    if (!list || !link)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    link->next = list->head;
+    list->head = link;
+
+    if (list->size == 0)
+    {
+        list->tail = link;
+    }
+
+    ++list->size;
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_islist_push_back(islist_t* list, islist_link_t* link)
+{
+    if (!list || !link)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    link->next = NULL;
+
+    if (list->size == 0)
+    {
+        list->head = link;
+    }
+    else
+    {
+        list->tail->next = link;
+    }
+
+    list->tail = link;
+    ++list->size;
+
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_islist_pop_front(islist_t* list, islist_link_t** link)
+{
+    if (!list)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    if (list->size == 0)
+    {
+        return DSA_EMPTY_LIST;
+    }
+
+    islist_link_t* node = list->head;
+    list->head = node->next;
+    node->next = NULL;
+
+    --list->size;
+
+    if (list->size == 0)
+    {
+        list->tail = NULL;
+    }
+
+    if (link)
+    {
+        *link = node;
+    }
+
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_islist_pop_back(islist_t* list, islist_link_t** link)
+{
+    if (!list)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    if (list->size == 0)
+    {
+        return DSA_EMPTY_LIST;
+    }
+
+    if (list->size == 1)
+    {
+        return dsa_islist_pop_front(list, link);
+    }
+
+    islist_link_t* current = list->head;
+
+    while (current->next != list->tail)
+    {
+        current = current->next;
+    }
+
+    islist_link_t* node = current->next;
+    current->next = NULL;
+    list->tail = current;
+
+    --list->size;
+
+    if (link)
+    {
+        *link = node;
+    }
+
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_islist_remove_after(islist_t* list, islist_link_t* prev, islist_link_t** link)
+{
+    if (!list)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    if (!prev)
+    {
+        return dsa_islist_pop_front(list, link);
+    }
+
+    if (!prev->next)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    islist_link_t* node = prev->next;
+    prev->next = node->next;
+    node->next = NULL;
+
+    if (list->tail == node)
+    {
+        list->tail = prev;
+    }
+
+    --list->size;
+
+    if (link)
+    {
+        *link = node;
+    }
+
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_islist_splice(islist_t* list, islist_t* other)
+{
+    if (!list || !other || list == other)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    if (other->size == 0)
+    {
+        return DSA_SUCCESS;
+    }
+
+    if (list->size == 0)
+    {
+        list->head = other->head;
+    }
+    else
+    {
+        list->tail->next = other->head;
+    }
+
+    list->tail = other->tail;
+    list->size += other->size;
+
+    return dsa_islist_init(other);
+}
+
+dsa_error_code_t dsa_islist_clear(islist_t* list)
+{
+    return dsa_islist_init(list);
+}
+
+dsa_error_code_t dsa_islist_reverse(islist_t* list)
+{
+    if (!list)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    list->tail = list->head;
+    islist_link_t* current = list->head;
+    islist_link_t* prev = NULL;
+    while (current)
+    {
+        islist_link_t* next = current->next;
+        current->next = prev;
+        prev = current;
+        current = next;
+    }
+
+    list->head = prev;
+
+    return DSA_SUCCESS;
+}
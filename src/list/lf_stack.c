@@ -0,0 +1,270 @@
+#include "dsa/list/lf_stack.h"
+
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+// Nodes are addressed by 32-bit indices so that an index and a version tag fit
+// together in a single 64-bit word, which every supported platform can update with
+// one compare-and-swap. Chunk k of the pool holds 2^(_LF_FIRST_CHUNK_BITS + k) nodes.
+#define _LF_NIL UINT32_MAX
+#define _LF_FIRST_CHUNK_BITS 6u
+#define _LF_MAX_CHUNKS (32u - _LF_FIRST_CHUNK_BITS)
+#define _LF_MAX_NODES (UINT32_MAX - (1u << _LF_FIRST_CHUNK_BITS))
+#define _LF_CACHE_LINE 64
+
+typedef struct
+{
+    void* data;
+    _Atomic uint32_t next;
+} _lf_node_t;
+
+struct lf_stack
+{
+    _Atomic uint64_t top;
+    char top_padding[_LF_CACHE_LINE - sizeof(uint64_t)];
+    _Atomic uint64_t free_top;
+    char free_padding[_LF_CACHE_LINE - sizeof(uint64_t)];
+    _Atomic uint64_t fresh_nodes;
+    _lf_node_t* _Atomic chunks[_LF_MAX_CHUNKS];
+    slist_destroy_element_func destroy_func;
+};
+
+static uint32_t _most_significant_bit(const uint32_t value)
+{
+#if defined(_MSC_VER)
+    unsigned long index = 0;
+    _BitScanReverse(&index, value);
+    return (uint32_t)index;
+#else
+    return 31u - (uint32_t)__builtin_clz(value);
+#endif
+}
+
+static uint64_t _pack(const uint32_t index, const uint32_t tag)
+{
+    return ((uint64_t)tag << 32) | index;
+}
+
+static uint32_t _index_of(const uint64_t tagged)
+{
+    return (uint32_t)(tagged & UINT32_MAX);
+}
+
+static uint32_t _tag_of(const uint64_t tagged)
+{
+    return (uint32_t)(tagged >> 32);
+}
+
+static uint32_t _chunk_of(const uint32_t index, uint32_t* offset)
+{
+    const uint32_t biased = index + (1u << _LF_FIRST_CHUNK_BITS);
+    const uint32_t msb = _most_significant_bit(biased);
+    *offset = biased - (1u << msb);
+    return msb - _LF_FIRST_CHUNK_BITS;
+}
+
+static _lf_node_t* _node_at(struct lf_stack* stack, const uint32_t index)
+{
+    uint32_t offset = 0;
+    const uint32_t chunk = _chunk_of(index, &offset);
+    _lf_node_t* nodes = atomic_load_explicit(&stack->chunks[chunk], memory_order_acquire);
+    return &nodes[offset];
+}
+
+static void _push_index(struct lf_stack* stack, _Atomic uint64_t* top, const uint32_t index)
+{
+    _lf_node_t* node = _node_at(stack, index);
+    uint64_t old_top = atomic_load_explicit(top, memory_order_relaxed);
+    uint64_t new_top = 0;
+
+    do
+    {
+        atomic_store_explicit(&node->next, _index_of(old_top), memory_order_relaxed);
+        new_top = _pack(index, _tag_of(old_top) + 1);
+    } while (!atomic_compare_exchange_weak_explicit(top, &old_top, new_top, memory_order_release, memory_order_relaxed));
+}
+
+static uint32_t _pop_index(struct lf_stack* stack, _Atomic uint64_t* top)
+{
+    uint64_t old_top = atomic_load_explicit(top, memory_order_acquire);
+
+    for (;;)
+    {
+        const uint32_t index = _index_of(old_top);
+        if (index == _LF_NIL)
+        {
+            return _LF_NIL;
+        }
+
+        // The node may be popped and reused concurrently; the value read here is then
+        // stale, but the tag makes the compare-and-swap below fail.
+        const uint32_t next = atomic_load_explicit(&_node_at(stack, index)->next, memory_order_relaxed);
+        const uint64_t new_top = _pack(next, _tag_of(old_top) + 1);
+
+        if (atomic_compare_exchange_weak_explicit(top, &old_top, new_top, memory_order_acquire, memory_order_acquire))
+        {
+            return index;
+        }
+    }
+}
+
+static bool _ensure_chunk(struct lf_stack* stack, const uint32_t chunk)
+{
+    if (atomic_load_explicit(&stack->chunks[chunk], memory_order_acquire))
+    {
+        return true;
+    }
+
+    const size_t chunk_size = (size_t)1 << (_LF_FIRST_CHUNK_BITS + chunk);
+    _lf_node_t* nodes = calloc(chunk_size, sizeof(*nodes));
+    if (!nodes)
+    {
+        return false;
+    }
+
+    // Several threads may race to allocate the same chunk; only one of them publishes it.
+    _lf_node_t* expected = NULL;
+    if (!atomic_compare_exchange_strong_explicit(&stack->chunks[chunk], &expected, nodes, memory_order_acq_rel, memory_order_acquire))
+    {
+        free(nodes);
+    }
+
+    return true;
+}
+
+static dsa_error_code_t _acquire_node(struct lf_stack* stack, uint32_t* index)
+{
+    *index = _pop_index(stack, &stack->free_top);
+    if (*index != _LF_NIL)
+    {
+        return DSA_SUCCESS;
+    }
+
+    // The chunk holding the next fresh index is allocated before the index is claimed, so a
+    // failed allocation leaves the index available for the next attempt.
+    uint64_t fresh = atomic_load_explicit(&stack->fresh_nodes, memory_order_relaxed);
+    do
+    {
+        if (fresh >= _LF_MAX_NODES)
+        {
+            return DSA_ALLOC_FAILURE;
+        }
+
+        uint32_t offset = 0;
+        if (!_ensure_chunk(stack, _chunk_of((uint32_t)fresh, &offset)))
+        {
+            return DSA_ALLOC_FAILURE;
+        }
+    } while (!atomic_compare_exchange_weak_explicit(&stack->fresh_nodes, &fresh, fresh + 1, memory_order_relaxed, memory_order_relaxed));
+
+    *index = (uint32_t)fresh;
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_lf_stack_create(lf_stack_t* handle, slist_destroy_element_func func)
+{
+    if (!handle)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    *handle = malloc(sizeof(**handle));
+
+    if (!(*handle))
+    {
+        return DSA_ALLOC_FAILURE;
+    }
+
+    atomic_init(&(*handle)->top, _pack(_LF_NIL, 0));
+    atomic_init(&(*handle)->free_top, _pack(_LF_NIL, 0));
+    atomic_init(&(*handle)->fresh_nodes, 0);
+    for (size_t i = 0; i < _LF_MAX_CHUNKS; i++)
+    {
+        atomic_init(&(*handle)->chunks[i], NULL);
+    }
+    (*handle)->destroy_func = func;
+
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_lf_stack_push(lf_stack_t handle, void* data)
+{
+    if (!handle || !data)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    uint32_t index = _LF_NIL;
+    const dsa_error_code_t result = _acquire_node(handle, &index);
+    if (result != DSA_SUCCESS)
+    {
+        return result;
+    }
+
+    _node_at(handle, index)->data = data;
+    _push_index(handle, &handle->top, index);
+
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_lf_stack_pop(lf_stack_t handle, void** data)
+{
+    if (!handle || !data)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    const uint32_t index = _pop_index(handle, &handle->top);
+    if (index == _LF_NIL)
+    {
+        return DSA_EMPTY_LIST;
+    }
+
+    _lf_node_t* node = _node_at(handle, index);
+    *data = node->data;
+    node->data = NULL;
+
+    _push_index(handle, &handle->free_top, index);
+
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_lf_stack_is_empty(lf_stack_t handle, bool* is_empty)
+{
+    if (!handle || !is_empty)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    *is_empty = _index_of(atomic_load_explicit(&handle->top, memory_order_acquire)) == _LF_NIL;
+    return DSA_SUCCESS;
+}
+
+void dsa_lf_stack_destroy(lf_stack_t handle)
+{
+    if (!handle)
+    {
+        return;
+    }
+
+    if (handle->destroy_func)
+    {
+        void* data = NULL;
+        while (dsa_lf_stack_pop(handle, &data) == DSA_SUCCESS)
+        {
+            handle->destroy_func(data);
+        }
+    }
+
+    for (size_t i = 0; i < _LF_MAX_CHUNKS; i++)
+    {
+        free(atomic_load_explicit(&handle->chunks[i], memory_order_relaxed));
+    }
+
+    free(handle);
+}
@@ -0,0 +1,290 @@
+#include "dsa/list/mpmc_queue.h"
+
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#if defined(_WIN32)
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+#else
+    #include <sched.h>
+#endif
+
+#define _MPMC_CACHE_LINE 64
+#define _MPMC_SPIN_LIMIT 64u
+
+typedef struct
+{
+    _Atomic size_t sequence;
+    void* data;
+} _mpmc_slot_t;
+
+struct mpmc_queue
+{
+    _Atomic size_t enqueue_position;
+    char enqueue_padding[_MPMC_CACHE_LINE - sizeof(size_t)];
+    _Atomic size_t dequeue_position;
+    char dequeue_padding[_MPMC_CACHE_LINE - sizeof(size_t)];
+    _mpmc_slot_t* slots;
+    size_t mask;
+    slist_destroy_element_func destroy_func;
+};
+
+static void _backoff(unsigned* attempt)
+{
+    if (*attempt < _MPMC_SPIN_LIMIT)
+    {
+        ++(*attempt);
+        return;
+    }
+
+#if defined(_WIN32)
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
+
+// A slot at `position` is ready for producers when its sequence equals `position`
+// and ready for consumers when it equals `position + 1`. Claims the longest run of
+// ready slots, up to `max_count`, by advancing `cursor` once.
+static size_t _claim(struct mpmc_queue* queue, _Atomic size_t* cursor, const size_t ready_offset, const size_t max_count, size_t* start)
+{
+    size_t position = atomic_load_explicit(cursor, memory_order_relaxed);
+
+    for (;;)
+    {
+        _mpmc_slot_t* slot = &queue->slots[position & queue->mask];
+        const size_t sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        const ptrdiff_t difference = (ptrdiff_t)(sequence - (position + ready_offset));
+
+        if (difference < 0)
+        {
+            return 0;
+        }
+
+        if (difference > 0)
+        {
+            // Another thread claimed this slot; retry from the current cursor.
+            position = atomic_load_explicit(cursor, memory_order_relaxed);
+            continue;
+        }
+
+        size_t count = 1;
+        while (count < max_count)
+        {
+            const size_t next = position + count;
+            _mpmc_slot_t* next_slot = &queue->slots[next & queue->mask];
+            if (atomic_load_explicit(&next_slot->sequence, memory_order_acquire) != next + ready_offset)
+            {
+                break;
+            }
+            ++count;
+        }
+
+        if (atomic_compare_exchange_weak_explicit(cursor, &position, position + count, memory_order_relaxed, memory_order_relaxed))
+        {
+            *start = position;
+            return count;
+        }
+    }
+}
+
+static void _publish_push(struct mpmc_queue* queue, const size_t position, void* data)
+{
+    _mpmc_slot_t* slot = &queue->slots[position & queue->mask];
+    slot->data = data;
+    atomic_store_explicit(&slot->sequence, position + 1, memory_order_release);
+}
+
+static void* _publish_pop(struct mpmc_queue* queue, const size_t position)
+{
+    _mpmc_slot_t* slot = &queue->slots[position & queue->mask];
+    void* data = slot->data;
+    slot->data = NULL;
+    atomic_store_explicit(&slot->sequence, position + queue->mask + 1, memory_order_release);
+    return data;
+}
+
+dsa_error_code_t dsa_mpmc_queue_create(mpmc_queue_t* handle, const size_t capacity, slist_destroy_element_func func)
+{
+    if (!handle || capacity == 0 || capacity > (SIZE_MAX / 2) / sizeof(_mpmc_slot_t))
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    size_t rounded_capacity = 1;
+    while (rounded_capacity < capacity)
+    {
+        rounded_capacity *= 2;
+    }
+
+    *handle = malloc(sizeof(**handle));
+    if (!(*handle))
+    {
+        return DSA_ALLOC_FAILURE;
+    }
+
+    (*handle)->slots = malloc(rounded_capacity * sizeof(_mpmc_slot_t));
+    if (!(*handle)->slots)
+    {
+        free(*handle);
+        *handle = NULL;
+        return DSA_ALLOC_FAILURE;
+    }
+
+    for (size_t i = 0; i < rounded_capacity; i++)
+    {
+        atomic_init(&(*handle)->slots[i].sequence, i);
+        (*handle)->slots[i].data = NULL;
+    }
+
+    atomic_init(&(*handle)->enqueue_position, 0);
+    atomic_init(&(*handle)->dequeue_position, 0);
+    (*handle)->mask = rounded_capacity - 1;
+    (*handle)->destroy_func = func;
+
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_mpmc_queue_get_capacity(mpmc_queue_t handle, size_t* capacity)
+{
+    if (!handle || !capacity)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    *capacity = handle->mask + 1;
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_mpmc_queue_try_push(mpmc_queue_t handle, void* data)
+{
+    if (!handle || !data)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    size_t position = 0;
+    if (_claim(handle, &handle->enqueue_position, 0, 1, &position) == 0)
+    {
+        return DSA_FULL;
+    }
+
+    _publish_push(handle, position, data);
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_mpmc_queue_push(mpmc_queue_t handle, void* data)
+{
+    if (!handle || !data)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    unsigned attempt = 0;
+    while (dsa_mpmc_queue_try_push(handle, data) == DSA_FULL)
+    {
+        _backoff(&attempt);
+    }
+
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_mpmc_queue_try_push_n(mpmc_queue_t handle, void* const* data, const size_t count, size_t* pushed)
+{
+    if (!handle || !data || count == 0 || !pushed)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (!data[i])
+        {
+            return DSA_INVALID_INPUT;
+        }
+    }
+
+    size_t position = 0;
+    *pushed = _claim(handle, &handle->enqueue_position, 0, count, &position);
+
+    for (size_t i = 0; i < *pushed; i++)
+    {
+        _publish_push(handle, position + i, data[i]);
+    }
+
+    return *pushed > 0 ? DSA_SUCCESS : DSA_FULL;
+}
+
+dsa_error_code_t dsa_mpmc_queue_try_pop(mpmc_queue_t handle, void** data)
+{
+    if (!handle || !data)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    size_t position = 0;
+    if (_claim(handle, &handle->dequeue_position, 1, 1, &position) == 0)
+    {
+        return DSA_EMPTY_LIST;
+    }
+
+    *data = _publish_pop(handle, position);
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_mpmc_queue_pop(mpmc_queue_t handle, void** data)
+{
+    if (!handle || !data)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    unsigned attempt = 0;
+    while (dsa_mpmc_queue_try_pop(handle, data) == DSA_EMPTY_LIST)
+    {
+        _backoff(&attempt);
+    }
+
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_mpmc_queue_try_pop_n(mpmc_queue_t handle, void** data, const size_t capacity, size_t* popped)
+{
+    if (!handle || !data || capacity == 0 || !popped)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    size_t position = 0;
+    *popped = _claim(handle, &handle->dequeue_position, 1, capacity, &position);
+
+    for (size_t i = 0; i < *popped; i++)
+    {
+        data[i] = _publish_pop(handle, position + i);
+    }
+
+    return *popped > 0 ? DSA_SUCCESS : DSA_EMPTY_LIST;
+}
+
+void dsa_mpmc_queue_destroy(mpmc_queue_t handle)
+{
+    if (!handle)
+    {
+        return;
+    }
+
+    if (handle->destroy_func)
+    {
+        void* data = NULL;
+        while (dsa_mpmc_queue_try_pop(handle, &data) == DSA_SUCCESS)
+        {
+            handle->destroy_func(data);
+        }
+    }
+
+    free(handle->slots);
+    free(handle);
+}
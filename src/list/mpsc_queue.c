@@ -0,0 +1,123 @@
+#include "dsa/list/mpsc_queue.h"
+
+#include <stdlib.h>
+
+struct mpsc_queue
+{
+    // Written by producers.
+    mpsc_queue_link_t* _Atomic head;
+    char head_padding[64 - sizeof(mpsc_queue_link_t*)];
+    // Owned by the consumer.
+    mpsc_queue_link_t* tail;
+    mpsc_queue_link_t stub;
+    slist_destroy_element_func destroy_func;
+};
+
+static void _link(struct mpsc_queue* queue, mpsc_queue_link_t* link)
+{
+    atomic_store_explicit(&link->next, NULL, memory_order_relaxed);
+    mpsc_queue_link_t* prev = atomic_exchange_explicit(&queue->head, link, memory_order_acq_rel);
+    atomic_store_explicit(&prev->next, link, memory_order_release);
+}
+
+dsa_error_code_t dsa_mpsc_queue_create(mpsc_queue_t* handle, slist_destroy_element_func func)
+{
+    if (!handle)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    *handle = malloc(sizeof(**handle));
+
+    if (!(*handle))
+    {
+        return DSA_ALLOC_FAILURE;
+    }
+
+    atomic_init(&(*handle)->stub.next, NULL);
+    atomic_init(&(*handle)->head, &(*handle)->stub);
+    (*handle)->tail = &(*handle)->stub;
+    (*handle)->destroy_func = func;
+
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_mpsc_queue_push(mpsc_queue_t handle, mpsc_queue_link_t* link)
+{
+    if (!handle || !link)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    _link(handle, link);
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_mpsc_queue_pop(mpsc_queue_t handle, mpsc_queue_link_t** link)
+{
+    if (!handle || !link)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    mpsc_queue_link_t* tail = handle->tail;
+    mpsc_queue_link_t* next = atomic_load_explicit(&tail->next, memory_order_acquire);
+
+    // Skip over the stub, which only marks the queue as empty.
+    if (tail == &handle->stub)
+    {
+        if (!next)
+        {
+            return DSA_EMPTY_LIST;
+        }
+
+        handle->tail = next;
+        tail = next;
+        next = atomic_load_explicit(&tail->next, memory_order_acquire);
+    }
+
+    if (next)
+    {
+        handle->tail = next;
+        *link = tail;
+        return DSA_SUCCESS;
+    }
+
+    // A producer has swapped the head but not yet linked its element.
+    if (tail != atomic_load_explicit(&handle->head, memory_order_acquire))
+    {
+        return DSA_EMPTY_LIST;
+    }
+
+    // The tail is the last element; re-insert the stub so that it can be detached.
+    _link(handle, &handle->stub);
+
+    next = atomic_load_explicit(&tail->next, memory_order_acquire);
+    if (next)
+    {
+        handle->tail = next;
+        *link = tail;
+        return DSA_SUCCESS;
+    }
+
+    return DSA_EMPTY_LIST;
+}
+
+void dsa_mpsc_queue_destroy(mpsc_queue_t handle)
+{
+    if (!handle)
+    {
+        return;
+    }
+
+    mpsc_queue_link_t* link = NULL;
+    while (dsa_mpsc_queue_pop(handle, &link) == DSA_SUCCESS)
+    {
+        if (handle->destroy_func)
+        {
+            handle->destroy_func(link);
+        }
+    }
+
+    free(handle);
+}
@@ -0,0 +1,359 @@
+#include "dsa/list/skiplist.h"
+
+#include <stdint.h>
+
+// Every level holds about a quarter of the nodes of the level below, which keeps the
+// expected number of pointers per node at 4/3. 32 levels cover far more than 2^32 elements.
+#define _SKIPLIST_MAX_LEVEL 32
+
+typedef struct skiplist_node
+{
+    void* data;
+    size_t level;
+    struct skiplist_node* next[];
+} _skiplist_node_t;
+
+struct skiplist
+{
+    _skiplist_node_t* head[_SKIPLIST_MAX_LEVEL];
+    size_t level;
+    size_t size;
+    uint64_t random_state;
+    skiplist_compare_func compare;
+    slist_destroy_element_func destroy_func;
+    dsa_allocator_t allocator;
+};
+
+static size_t _random_level(struct skiplist* list)
+{
+    // xorshift64: cheap, and a fixed seed keeps the structure reproducible between runs.
+    uint64_t bits = list->random_state;
+    bits ^= bits << 13;
+    bits ^= bits >> 7;
+    bits ^= bits << 17;
+    list->random_state = bits;
+
+    size_t level = 1;
+    while ((bits & 3u) == 0 && level < _SKIPLIST_MAX_LEVEL)
+    {
+        ++level;
+        bits >>= 2;
+    }
+
+    return level;
+}
+
+// Returns the next-pointer array of the last node ordering before `key` on every level,
+// or of the head. `update` may be NULL when only the position on the bottom level is needed.
+static _skiplist_node_t** _find_predecessors(struct skiplist* list, const void* key, _skiplist_node_t*** update)
+{
+    _skiplist_node_t** next = list->head;
+
+    for (size_t i = list->level; i-- > 0;)
+    {
+        while (next[i] && list->compare(next[i]->data, key) < 0)
+        {
+            next = next[i]->next;
+        }
+
+        if (update)
+        {
+            update[i] = next;
+        }
+    }
+
+    return next;
+}
+
+static size_t _node_bytes(const size_t level)
+{
+    return sizeof(_skiplist_node_t) + level * sizeof(_skiplist_node_t*);
+}
+
+static _skiplist_node_t* _lower_bound(struct skiplist* list, const void* key)
+{
+    return _find_predecessors(list, key, NULL)[0];
+}
+
+static void _delete_nodes(struct skiplist* list)
+{
+    _skiplist_node_t* current = list->head[0];
+
+    while (current)
+    {
+        _skiplist_node_t* next = current->next[0];
+
+        if (list->destroy_func)
+        {
+            list->destroy_func(current->data);
+        }
+        dsa_deallocate(&list->allocator, current, _node_bytes(current->level));
+
+        current = next;
+    }
+}
+
+dsa_error_code_t dsa_skiplist_create(skiplist_t* handle, skiplist_compare_func compare, slist_destroy_element_func func)
+{
+    return dsa_skiplist_create_with_allocator(handle, compare, func, NULL);
+}
+
+dsa_error_code_t dsa_skiplist_create_with_allocator(skiplist_t* handle, skiplist_compare_func compare, slist_destroy_element_func func,
+                                                    const dsa_allocator_t* allocator)
+{
+    if (!handle || !compare || (allocator && (!allocator->allocate || !allocator->deallocate)))
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    const dsa_allocator_t resolved = allocator ? *allocator : *dsa_allocator_get_default();
+
+    *handle = dsa_allocate(&resolved, sizeof(**handle));
+
+    if (!(*handle))
+    {
+        return DSA_ALLOC_FAILURE;
+    }
+
+    for (size_t i = 0; i < _SKIPLIST_MAX_LEVEL; i++)
+    {
+        (*handle)->head[i] = NULL;
+    }
+    (*handle)->level = 1;
+    (*handle)->size = 0;
+    (*handle)->random_state = UINT64_C(0x9E3779B97F4A7C15);
+    (*handle)->compare = compare;
+    (*handle)->destroy_func = func;
+    (*handle)->allocator = resolved;
+
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_skiplist_insert(skiplist_t handle, void* data, bool* inserted)
+{
+    if (!handle || !data)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    _skiplist_node_t** update[_SKIPLIST_MAX_LEVEL];
+    _skiplist_node_t** prev = _find_predecessors(handle, data, update);
+
+    if (prev[0] && handle->compare(prev[0]->data, data) == 0)
+    {
+        if (inserted)
+        {
+            *inserted = false;
+        }
+        return DSA_SUCCESS;
+    }
+
+    const size_t level = _random_level(handle);
+    _skiplist_node_t* node = dsa_allocate(&handle->allocator, _node_bytes(level));
+    if (!node)
+    {
+        return DSA_ALLOC_FAILURE;
+    }
+
+    node->data = data;
+    node->level = level;
+
+    for (size_t i = handle->level; i < level; i++)
+    {
+        update[i] = handle->head;
+    }
+    if (level > handle->level)
+    {
+        handle->level = level;
+    }
+
+    for (size_t i = 0; i < level; i++)
+    {
+        node->next[i] = update[i][i];
+        update[i][i] = node;
+    }
+
+    ++handle->size;
+
+    if (inserted)
+    {
+        *inserted = true;
+    }
+
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_skiplist_find(skiplist_t handle, const void* key, void** data)
+{
+    if (!handle || !key || !data)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    _skiplist_node_t* node = _lower_bound(handle, key);
+    *data = (node && handle->compare(node->data, key) == 0) ? node->data : NULL;
+
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_skiplist_erase(skiplist_t handle, const void* key, bool* erased)
+{
+    if (!handle || !key)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    _skiplist_node_t** update[_SKIPLIST_MAX_LEVEL];
+    _skiplist_node_t* node = _find_predecessors(handle, key, update)[0];
+
+    if (!node || handle->compare(node->data, key) != 0)
+    {
+        if (erased)
+        {
+            *erased = false;
+        }
+        return DSA_SUCCESS;
+    }
+
+    for (size_t i = 0; i < node->level; i++)
+    {
+        update[i][i] = node->next[i];
+    }
+
+    while (handle->level > 1 && !handle->head[handle->level - 1])
+    {
+        --handle->level;
+    }
+
+    --handle->size;
+
+    if (handle->destroy_func)
+    {
+        handle->destroy_func(node->data);
+    }
+    dsa_deallocate(&handle->allocator, node, _node_bytes(node->level));
+
+    if (erased)
+    {
+        *erased = true;
+    }
+
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_skiplist_lower_bound(skiplist_t handle, const void* key, skiplist_iterator_t* it)
+{
+    if (!handle || !key || !it)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    *it = _lower_bound(handle, key);
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_skiplist_begin(skiplist_t handle, skiplist_iterator_t* it)
+{
+    if (!handle || !it)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    *it = handle->head[0];
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_skiplist_next(skiplist_iterator_t* it)
+{
+    if (!it || !(*it))
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    *it = (*it)->next[0];
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_skiplist_get(skiplist_iterator_t it, void** data)
+{
+    if (!it || !data)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    *data = it->data;
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_skiplist_for_each_range(skiplist_t handle, const void* first, const void* last,
+                                             dsa_operation_with_context operation, void* ctx)
+{
+    if (!handle || !operation)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    _skiplist_node_t* node = first ? _lower_bound(handle, first) : handle->head[0];
+
+    while (node && (!last || handle->compare(node->data, last) < 0))
+    {
+        operation(node->data, ctx);
+        node = node->next[0];
+    }
+
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_skiplist_get_size(skiplist_t handle, size_t* size)
+{
+    if (!handle || !size)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    *size = handle->size;
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_skiplist_is_empty(skiplist_t handle, bool* is_empty)
+{
+    if (!handle || !is_empty)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    *is_empty = (handle->size == 0);
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_skiplist_clear(skiplist_t handle)
+{
+    if (!handle)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    _delete_nodes(handle);
+
+    for (size_t i = 0; i < _SKIPLIST_MAX_LEVEL; i++)
+    {
+        handle->head[i] = NULL;
+    }
+    handle->level = 1;
+    handle->size = 0;
+
+    return DSA_SUCCESS;
+}
+
+void dsa_skiplist_destroy(skiplist_t handle)
+{
+    if (!handle)
+    {
+        return;
+    }
+
+    _delete_nodes(handle);
+
+    const dsa_allocator_t allocator = handle->allocator;
+    dsa_deallocate(&allocator, handle, sizeof(*handle));
+}
@@ -1,70 +1,193 @@
 #include "dsa/list/slist.h"
+#include "dsa/common/stats.h"
+#include "dsa/common/trace.h"
+#include "dsa/list/islist.h"
 
-#include <stdlib.h>
+#include <stdint.h>
 
-typedef struct _slist_node_t
+struct _slist_block_t;
+
+typedef struct slist_node
 {
+    islist_link_t link;
     void* data;
-    struct _slist_node_t* next;
+    struct _slist_block_t* block;
 }_slist_node_t;
 
+// Nodes created by dsa_slist_push_back_n() share a single allocation.
+// The block is released once its last node has been deleted.
+typedef struct _slist_block_t
+{
+    size_t live_nodes;
+    size_t node_count;
+    _slist_node_t nodes[];
+}_slist_block_t;
+
+#define _SLIST_DESTROY_BATCH 64
+
 struct slist
 {
-    _slist_node_t* head;
-    _slist_node_t* tail;
-    size_t size;
+    islist_t nodes;
     slist_destroy_element_func destroy_func;
+    slist_destroy_batch_func destroy_batch_func;
+    dsa_allocator_t allocator;
 };
 
-static _slist_node_t* _create_node(void* data, _slist_node_t* next)
+static _slist_node_t* _node_from_link(islist_link_t* link)
 {
-    _slist_node_t* new_node = malloc(sizeof(*new_node));
+    return link ? DSA_CONTAINER_OF(link, _slist_node_t, link) : NULL;
+}
+
+static size_t _block_bytes(const size_t count)
+{
+    return sizeof(_slist_block_t) + count * sizeof(_slist_node_t);
+}
+
+static _slist_node_t* _create_node(void* data, const dsa_allocator_t* allocator)
+{
+    _slist_node_t* new_node = dsa_allocate(allocator, sizeof(*new_node));
     if (!new_node)
     {
         return NULL;
     }
 
+    new_node->link.next = NULL;
     new_node->data = data;
-    new_node->next = next;
+    new_node->block = NULL;
 
     return new_node;
 }
 
-static void _delete_node(_slist_node_t* node, slist_destroy_element_func func)
+static _slist_block_t* _create_block(const size_t count, const dsa_allocator_t* allocator)
+{
+    if (count > (SIZE_MAX - sizeof(_slist_block_t)) / sizeof(_slist_node_t))
+    {
+        return NULL;
+    }
+
+    _slist_block_t* block = dsa_allocate(allocator, _block_bytes(count));
+    if (!block)
+    {
+        return NULL;
+    }
+
+    block->live_nodes = count;
+    block->node_count = count;
+    return block;
+}
+
+static void _destroy_data(void** data, const size_t count, slist_destroy_element_func func, slist_destroy_batch_func batch_func)
+{
+    if (batch_func)
+    {
+        batch_func(data, count);
+    }
+    else if (func)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            func(data[i]);
+        }
+    }
+}
+
+static void _release_node(_slist_node_t* node, const dsa_allocator_t* allocator)
+{
+    node->data = NULL;
+
+    _slist_block_t* block = node->block;
+    if (!block)
+    {
+        dsa_deallocate(allocator, node, sizeof(*node));
+    }
+    else if (--block->live_nodes == 0)
+    {
+        dsa_deallocate(allocator, block, _block_bytes(block->node_count));
+    }
+}
+
+static void _delete_node(_slist_node_t* node, const struct slist* list)
 {
     if (!node)
     {
         return;
     }
 
-    if (func)
+    _destroy_data(&node->data, 1, list->destroy_func, list->destroy_batch_func);
+    _release_node(node, &list->allocator);
+}
+
+// Deletes up to `max_count` nodes starting at `*head` and advances `*head` past them.
+// Data pointers are gathered so that the destroy callbacks run in batches, separately
+// from the node frees.
+static size_t _delete_nodes(islist_link_t** head, const size_t max_count, slist_destroy_element_func func, slist_destroy_batch_func batch_func,
+                            const dsa_allocator_t* allocator)
+{
+    void* data[_SLIST_DESTROY_BATCH];
+    _slist_node_t* nodes[_SLIST_DESTROY_BATCH];
+    size_t deleted = 0;
+
+    while (*head && deleted < max_count)
     {
-        func(node->data);
+        size_t count = 0;
+        while (*head && count < _SLIST_DESTROY_BATCH && deleted + count < max_count)
+        {
+            nodes[count] = _node_from_link(*head);
+            data[count] = nodes[count]->data;
+            *head = (*head)->next;
+            ++count;
+        }
+
+        _destroy_data(data, count, func, batch_func);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            _release_node(nodes[i], allocator);
+        }
+
+        deleted += count;
     }
 
-    node->data = NULL;
-    free(node);
+    return deleted;
 }
 
 dsa_error_code_t dsa_slist_create(slist_t* handle, slist_destroy_element_func func)
 {
-    if (!handle)
+    return dsa_slist_create_with_allocator(handle, func, NULL);
+}
+
+dsa_error_code_t dsa_slist_create_with_allocator(slist_t* handle, slist_destroy_element_func func, const dsa_allocator_t* allocator)
+{
+    if (!handle || (allocator && (!allocator->allocate || !allocator->deallocate)))
     {
         return DSA_INVALID_INPUT;
     }
 
-    *handle = malloc(sizeof(**handle));
+    const dsa_allocator_t resolved = allocator ? *allocator : *dsa_allocator_get_default();
+
+    *handle = dsa_allocate(&resolved, sizeof(**handle));
 
     if (!(*handle))
     {
         return DSA_ALLOC_FAILURE;
     }
 
-    (*handle)->head = NULL;
-    (*handle)->tail = NULL;
-    (*handle)->size = 0;
+    dsa_islist_init(&(*handle)->nodes);
     (*handle)->destroy_func = func;
+    (*handle)->destroy_batch_func = NULL;
+    (*handle)->allocator = resolved;
+
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_slist_set_destroy_batch(slist_t handle, slist_destroy_batch_func func)
+{
+    if (!handle)
+    {
+        return DSA_INVALID_INPUT;
+    }
 
+    handle->destroy_batch_func = func;
     return DSA_SUCCESS;
 }
 
@@ -75,7 +198,8 @@ dsa_error_code_t dsa_slist_get_head(slist_t handle, void** head)
         return DSA_INVALID_INPUT;
     }
 
-    *head = handle->head ? handle->head->data : NULL;
+    _slist_node_t* node = _node_from_link(handle->nodes.head);
+    *head = node ? node->data : NULL;
     return DSA_SUCCESS;
 }
 
@@ -86,32 +210,30 @@ dsa_error_code_t dsa_slist_get_tail(slist_t handle, void** tail)
         return DSA_INVALID_INPUT;
     }
 
-    *tail = handle->tail ? handle->tail->data : NULL;
+    _slist_node_t* node = _node_from_link(handle->nodes.tail);
+    *tail = node ? node->data : NULL;
 
     return DSA_SUCCESS;
 }
 
 dsa_error_code_t dsa_slist_get_size(const slist_t handle, size_t* size)
 {
-    if (!handle || !size)
+    if (!handle)
     {
         return DSA_INVALID_INPUT;
     }
 
-    *size = handle->size;
-
-    return DSA_SUCCESS;
+    return dsa_islist_get_size(&handle->nodes, size);
 }
 
 dsa_error_code_t dsa_slist_is_empty(slist_t handle, bool* is_empty)
 {
-    if (!handle || !is_empty)
+    if (!handle)
     {
         return DSA_INVALID_INPUT;
     }
 
-    *is_empty = (handle->size == 0);
-    return DSA_SUCCESS;
+    return dsa_islist_is_empty(&handle->nodes, is_empty);
 }
 
 dsa_error_code_t dsa_slist_push_front(slist_t handle, void* data)
@@ -121,116 +243,228 @@ dsa_error_code_t dsa_slist_push_front(slist_t handle, void* data)
         return DSA_INVALID_INPUT;
     }
 
-    _slist_node_t* new_node = _create_node(data, handle->head);
-    if (!new_node)
+    DSA_TRACE_ENTRY(slist_push_front, handle->nodes.size, sizeof(void*));
+
+    dsa_error_code_t result = DSA_ALLOC_FAILURE;
+    _slist_node_t* new_node = _create_node(data, &handle->allocator);
+    if (new_node)
     {
-        return DSA_ALLOC_FAILURE;
+        result = dsa_islist_push_front(&handle->nodes, &new_node->link);
     }
 
-    handle->head = new_node;
+    DSA_TRACE_EXIT(slist_push_front, handle->nodes.size, sizeof(void*));
+    return result;
+}
 
-    if (handle->size == 0)
+dsa_error_code_t dsa_slist_push_back(slist_t handle, void* data)
+{
+    if (!handle || !data)
     {
-        handle->tail = new_node;
+        return DSA_INVALID_INPUT;
     }
 
-    ++handle->size;
-    return DSA_SUCCESS;
+    DSA_TRACE_ENTRY(slist_push_back, handle->nodes.size, sizeof(void*));
+
+    dsa_error_code_t result = DSA_ALLOC_FAILURE;
+    _slist_node_t* new_node = _create_node(data, &handle->allocator);
+    if (new_node)
+    {
+        result = dsa_islist_push_back(&handle->nodes, &new_node->link);
+    }
+
+    DSA_TRACE_EXIT(slist_push_back, handle->nodes.size, sizeof(void*));
+    return result;
 }
 
-dsa_error_code_t dsa_slist_push_back(slist_t handle, void* data)
+dsa_error_code_t dsa_slist_push_back_n(slist_t handle, void* const* data, const size_t count)
 {
-    if (!handle || !data)
+    if (!handle || !data || count == 0)
     {
         return DSA_INVALID_INPUT;
     }
 
-    _slist_node_t* new_node = _create_node(data, NULL);
-    if (!new_node)
+    for (size_t i = 0; i < count; i++)
+    {
+        if (!data[i])
+        {
+            return DSA_INVALID_INPUT;
+        }
+    }
+
+    _slist_block_t* block = _create_block(count, &handle->allocator);
+    if (!block)
     {
         return DSA_ALLOC_FAILURE;
     }
 
-    if (handle->size == 0)
+    islist_t chain;
+    dsa_islist_init(&chain);
+
+    for (size_t i = 0; i < count; i++)
     {
-        handle->head = new_node;
+        _slist_node_t* node = &block->nodes[i];
+        node->data = data[i];
+        node->block = block;
+        dsa_islist_push_back(&chain, &node->link);
     }
-    else
+
+    return dsa_islist_splice(&handle->nodes, &chain);
+}
+
+dsa_error_code_t dsa_slist_splice(slist_t handle, slist_t other)
+{
+    if (!handle || !other || handle == other || handle->destroy_func != other->destroy_func ||
+        handle->destroy_batch_func != other->destroy_batch_func || !dsa_allocator_equals(&handle->allocator, &other->allocator))
     {
-        handle->tail->next = new_node;
+        return DSA_INVALID_INPUT;
     }
 
-    handle->tail = new_node;
-    ++handle->size;
+    return dsa_islist_splice(&handle->nodes, &other->nodes);
+}
+
+dsa_error_code_t dsa_slist_to_array(slist_t handle, void** array, const size_t capacity)
+{
+    if (!handle || !array || capacity < handle->nodes.size)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    size_t index = 0;
+    islist_link_t* link = NULL;
+    DSA_ISLIST_FOR_EACH(link, &handle->nodes)
+    {
+        array[index++] = _node_from_link(link)->data;
+    }
 
     return DSA_SUCCESS;
 }
 
-dsa_error_code_t dsa_slist_pop_front(slist_t handle)
+dsa_error_code_t dsa_slist_begin(slist_t handle, slist_iterator_t* it)
 {
-    if (!handle)
+    if (!handle || !it)
     {
         return DSA_INVALID_INPUT;
     }
 
-    if (handle->size == 0)
+    *it = _node_from_link(handle->nodes.head);
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_slist_next(slist_iterator_t* it)
+{
+    if (!it || !(*it))
     {
-        return DSA_EMPTY_LIST;
+        return DSA_INVALID_INPUT;
     }
 
-    _slist_node_t* node = handle->head;
-    handle->head = node->next;
+    *it = _node_from_link((*it)->link.next);
+    return DSA_SUCCESS;
+}
 
-    _delete_node(node, handle->destroy_func);
+dsa_error_code_t dsa_slist_get(slist_iterator_t it, void** data)
+{
+    if (!it || !data)
+    {
+        return DSA_INVALID_INPUT;
+    }
 
-    --handle->size;
+    *data = it->data;
+    return DSA_SUCCESS;
+}
 
-    if (handle->size == 0)
+dsa_error_code_t dsa_slist_for_each(slist_t handle, dsa_operation_with_context operation, void* ctx)
+{
+    if (!handle || !operation)
     {
-        handle->tail = NULL;
+        return DSA_INVALID_INPUT;
+    }
+
+    islist_link_t* link = NULL;
+    DSA_ISLIST_FOR_EACH(link, &handle->nodes)
+    {
+        operation(_node_from_link(link)->data, ctx);
     }
 
     return DSA_SUCCESS;
 }
 
-dsa_error_code_t dsa_slist_pop_back(slist_t handle)
+dsa_error_code_t dsa_slist_remove_if(slist_t handle, slist_predicate_func predicate, void* ctx, size_t* removed)
 {
-    if (!handle)
+    if (!handle || !predicate)
     {
         return DSA_INVALID_INPUT;
     }
 
-    if (handle->size == 0)
+    size_t removed_count = 0;
+    islist_link_t* prev = NULL;
+    islist_link_t* current = handle->nodes.head;
+
+    while (current)
     {
-        return DSA_EMPTY_LIST;
+        islist_link_t* next = current->next;
+        _slist_node_t* node = _node_from_link(current);
+
+        DSA_STATS_ADD(comparisons, 1);
+        if (predicate(node->data, ctx))
+        {
+            dsa_islist_remove_after(&handle->nodes, prev, NULL);
+            _delete_node(node, handle);
+            ++removed_count;
+        }
+        else
+        {
+            prev = current;
+        }
+
+        current = next;
     }
 
-    if (handle->size == 1)
+    if (removed)
     {
-        _slist_node_t* node = handle->head;
-        _delete_node(node, handle->destroy_func);
-        handle->head = NULL;
-        handle->tail = NULL;
-        --handle->size;
-        return DSA_SUCCESS;
+        *removed = removed_count;
     }
 
-    _slist_node_t* current = handle->head;
+    return DSA_SUCCESS;
+}
 
-    while (current->next != handle->tail)
+dsa_error_code_t dsa_slist_pop_front(slist_t handle)
+{
+    if (!handle)
     {
-        current = current->next;
+        return DSA_INVALID_INPUT;
     }
 
-    _slist_node_t* node = current->next;
-    current->next = NULL;
-    _delete_node(node, handle->destroy_func);
+    DSA_TRACE_ENTRY(slist_pop_front, handle->nodes.size, sizeof(void*));
 
-    --handle->size;
+    islist_link_t* link = NULL;
+    const dsa_error_code_t result = dsa_islist_pop_front(&handle->nodes, &link);
+    if (result == DSA_SUCCESS)
+    {
+        _delete_node(_node_from_link(link), handle);
+    }
 
-    handle->tail = current;
+    DSA_TRACE_EXIT(slist_pop_front, handle->nodes.size, sizeof(void*));
+    return result;
+}
 
-    return DSA_SUCCESS;
+dsa_error_code_t dsa_slist_pop_back(slist_t handle)
+{
+    if (!handle)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    DSA_TRACE_ENTRY(slist_pop_back, handle->nodes.size, sizeof(void*));
+
+    islist_link_t* link = NULL;
+    const dsa_error_code_t result = dsa_islist_pop_back(&handle->nodes, &link);
+    if (result == DSA_SUCCESS)
+    {
+        _delete_node(_node_from_link(link), handle);
+    }
+
+    DSA_TRACE_EXIT(slist_pop_back, handle->nodes.size, sizeof(void*));
+    return result;
 }
 
 dsa_error_code_t dsa_slist_clear(slist_t handle)
@@ -240,62 +474,71 @@ dsa_error_code_t dsa_slist_clear(slist_t handle)
         return DSA_INVALID_INPUT;
     }
 
-    if (handle->size == 0)
+    if (handle->nodes.size == 0)
     {
         return DSA_SUCCESS;
     }
 
-    _slist_node_t* current = handle->head;
-    while (current)
+    _delete_nodes(&handle->nodes.head, SIZE_MAX, handle->destroy_func, handle->destroy_batch_func, &handle->allocator);
+
+    return dsa_islist_clear(&handle->nodes);
+}
+
+dsa_error_code_t dsa_slist_detach(slist_t handle, slist_chain_t* chain)
+{
+    if (!handle || !chain)
     {
-        _slist_node_t* next = current->next;
-        _delete_node(current, handle->destroy_func);
-        current = next;
+        return DSA_INVALID_INPUT;
     }
 
-    handle->head = NULL;
-    handle->tail = NULL;
-    handle->size = 0;
-    return DSA_SUCCESS;
+    chain->head = _node_from_link(handle->nodes.head);
+    chain->size = handle->nodes.size;
+    chain->destroy_func = handle->destroy_func;
+    chain->destroy_batch_func = handle->destroy_batch_func;
+    chain->allocator = handle->allocator;
+
+    return dsa_islist_clear(&handle->nodes);
 }
 
-dsa_error_code_t dsa_slist_reverse(slist_t handle)
+dsa_error_code_t dsa_slist_chain_reclaim(slist_chain_t* chain, const size_t max_count, size_t* remaining)
 {
-    if (!handle)
+    if (!chain)
     {
         return DSA_INVALID_INPUT;
     }
 
-    handle->tail = handle->head;
-    _slist_node_t* current = handle->head;
-    _slist_node_t* prev = NULL;
-    while (current)
+    islist_link_t* head = chain->head ? &chain->head->link : NULL;
+    chain->size -= _delete_nodes(&head, max_count == 0 ? SIZE_MAX : max_count, chain->destroy_func, chain->destroy_batch_func,
+                                 &chain->allocator);
+    chain->head = _node_from_link(head);
+
+    if (remaining)
     {
-        _slist_node_t* next = current->next;
-        current->next = prev;
-        prev = current;
-        current = next;
+        *remaining = chain->size;
     }
 
-    handle->head = prev;
-
     return DSA_SUCCESS;
 }
 
-void dsa_slist_destroy(slist_t handle)
+dsa_error_code_t dsa_slist_reverse(slist_t handle)
 {
     if (!handle)
     {
-        return;
+        return DSA_INVALID_INPUT;
     }
 
-    _slist_node_t* current = handle->head;
-    while (current)
+    return dsa_islist_reverse(&handle->nodes);
+}
+
+void dsa_slist_destroy(slist_t handle)
+{
+    if (!handle)
     {
-        _slist_node_t* next = current->next;
-        _delete_node(current, handle->destroy_func);
-        current = next;
+        return;
     }
 
-    free(handle);
+    const dsa_allocator_t allocator = handle->allocator;
+    _delete_nodes(&handle->nodes.head, SIZE_MAX, handle->destroy_func, handle->destroy_batch_func, &allocator);
+
+    dsa_deallocate(&allocator, handle, sizeof(*handle));
 }
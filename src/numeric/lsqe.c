@@ -1,14 +1,11 @@
 #include "dsa/numeric/lsqe.h"
 
+#include "dsa/common/trace.h"
+
 #include <math.h>
 
-bool dsa_lsqe(const double *x, const double *y, const size_t size, double *a, double *b)
+static bool _lsqe(const double *x, const double *y, const size_t size, double *a, double *b)
 {
-    if (!x || !y || size < 2 || !a || !b)
-    {
-        return false;
-    }
-
     double sumxy = 0.0;
     double sumx = 0.0;
     double sumx2 = 0.0;
@@ -35,3 +32,17 @@ bool dsa_lsqe(const double *x, const double *y, const size_t size, double *a, do
 
     return true;
 }
+
+bool dsa_lsqe(const double *x, const double *y, const size_t size, double *a, double *b)
+{
+    if (!x || !y || size < 2 || !a || !b)
+    {
+        return false;
+    }
+
+    DSA_TRACE_ENTRY(lsqe, size, sizeof(double));
+    const bool result = _lsqe(x, y, size, a, b);
+    DSA_TRACE_EXIT(lsqe, size, sizeof(double));
+
+    return result;
+}
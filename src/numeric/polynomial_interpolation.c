@@ -1,18 +1,15 @@
 #include "dsa/numeric/polynomial_interpolation.h"
 
+#include "dsa/common/trace.h"
+
 #include <math.h>
 
-bool dsa_interpolation_find_newton_coefficients(
+static bool _find_newton_coefficients(
     const double * restrict x,
     const double * restrict fx,
     double * restrict coefficients,
     size_t n)
 {
-    if (!x || !fx || !coefficients || n < 1)
-    {
-        return false;
-    }
-
     for (size_t i = 0; i < n; i++)
     {
         coefficients[i] = fx[i];
@@ -37,6 +34,24 @@ bool dsa_interpolation_find_newton_coefficients(
     return true;
 }
 
+bool dsa_interpolation_find_newton_coefficients(
+    const double * restrict x,
+    const double * restrict fx,
+    double * restrict coefficients,
+    size_t n)
+{
+    if (!x || !fx || !coefficients || n < 1)
+    {
+        return false;
+    }
+
+    DSA_TRACE_ENTRY(newton_coefficients, n, sizeof(double));
+    const bool result = _find_newton_coefficients(x, fx, coefficients, n);
+    DSA_TRACE_EXIT(newton_coefficients, n, sizeof(double));
+
+    return result;
+}
+
 bool dsa_interpolation_evaluate_newton_polynomial(
     const double * restrict x,
     const double * restrict coefficients,
@@ -50,6 +65,8 @@ bool dsa_interpolation_evaluate_newton_polynomial(
         return false;
     }
 
+    DSA_TRACE_ENTRY(newton_evaluate, m, sizeof(double));
+
     for (size_t i = 0; i < m; i++)
     {
         pz[i] = coefficients[0];
@@ -62,5 +79,7 @@ bool dsa_interpolation_evaluate_newton_polynomial(
         }
     }
 
+    DSA_TRACE_EXIT(newton_evaluate, m, sizeof(double));
+
     return true;
 }
@@ -1,19 +1,16 @@
 #include "dsa/numeric/root.h"
 
+#include "dsa/common/trace.h"
+
 #include <math.h>
 
-dsa_root_status dsa_find_root_newton(
+static dsa_root_status _find_root_newton(
     double (*f)(double x),
     double (*g)(double x),
     double *x,
     size_t *n,
     const double delta)
 {
-    if (!f || !g || !x || !n || *n < 2 || delta <= 0.0)
-    {
-        return DSA_ROOT_INVALID_ARGUMENT;
-    }
-
     static const double epsilon = 1e-12;
 
     size_t index = 0;
@@ -46,3 +43,23 @@ dsa_root_status dsa_find_root_newton(
     *n = index + 1;
     return DSA_ROOT_MAX_ITERATIONS;
 }
+
+dsa_root_status dsa_find_root_newton(
+    double (*f)(double x),
+    double (*g)(double x),
+    double *x,
+    size_t *n,
+    const double delta)
+{
+    if (!f || !g || !x || !n || *n < 2 || delta <= 0.0)
+    {
+        return DSA_ROOT_INVALID_ARGUMENT;
+    }
+
+    // The exit point reports the number of approximations actually written to `x`.
+    DSA_TRACE_ENTRY(find_root_newton, *n, sizeof(double));
+    const dsa_root_status status = _find_root_newton(f, g, x, n, delta);
+    DSA_TRACE_EXIT(find_root_newton, *n, sizeof(double));
+
+    return status;
+}
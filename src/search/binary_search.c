@@ -1,18 +1,14 @@
+#include "dsa/common/stats.h"
+#include "dsa/common/trace.h"
 #include "dsa/search/binary_search.h"
 
-dsa_error_code_t dsa_binary_search_index(
+static size_t _binary_search_index(
     const void *target,
     const void *sorted,
     const size_t size,
     const size_t elem_size,
-    int (*compare)(const void *key1, const void *key2),
-    size_t* found_index)
+    int (*compare)(const void *key1, const void *key2))
 {
-    if (!target || !sorted || size == 0 || elem_size == 0 || !compare || !found_index)
-    {
-        return DSA_INVALID_INPUT;
-    }
-
     size_t left = 0;
     size_t right = size;
     const char* buffer = sorted;
@@ -21,6 +17,7 @@ dsa_error_code_t dsa_binary_search_index(
     {
         const size_t middle = left + (right - left) / 2;
 
+        DSA_STATS_ADD(comparisons, 1);
         const int comparison_result = compare(target, &buffer[middle * elem_size]);
         if (comparison_result > 0)
         {
@@ -32,11 +29,29 @@ dsa_error_code_t dsa_binary_search_index(
         }
         else
         {
-            *found_index = middle;
-            return DSA_SUCCESS;
+            return middle;
         }
     }
 
-    *found_index = size;
+    return size;
+}
+
+dsa_error_code_t dsa_binary_search_index(
+    const void *target,
+    const void *sorted,
+    const size_t size,
+    const size_t elem_size,
+    int (*compare)(const void *key1, const void *key2),
+    size_t* found_index)
+{
+    if (!target || !sorted || size == 0 || elem_size == 0 || !compare || !found_index)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    DSA_TRACE_ENTRY(binary_search, size, elem_size);
+    *found_index = _binary_search_index(target, sorted, size, elem_size, compare);
+    DSA_TRACE_EXIT(binary_search, size, elem_size);
+
     return DSA_SUCCESS;
 }
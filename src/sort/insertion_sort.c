@@ -1,23 +1,33 @@
+#include "dsa/common/stats.h"
+#include "dsa/common/trace.h"
 #include "dsa/sort/insertion_sort.h"
 
-#include <stdlib.h>
 #include <string.h>
 
+// Key elements up to this size are kept on the stack, so typical sorts never allocate.
+#define _INSERTION_SORT_STACK_KEY 64
+
 dsa_error_code_t dsa_insertion_sort(
     void* const data,
     const size_t size,
     const size_t elem_size,
     int (*compare)(const void* key1, const void* key2))
 {
-    if (!data || !compare || elem_size == 0)
-    {
-        return DSA_INVALID_INPUT;
-    }
+    return dsa_insertion_sort_with_allocator(data, size, elem_size, compare, NULL);
+}
 
+static dsa_error_code_t _insertion_sort(
+    void* const data,
+    const size_t size,
+    const size_t elem_size,
+    int (*compare)(const void* key1, const void* key2),
+    const dsa_allocator_t* allocator)
+{
     char* arr = data;
 
-    // Allocate storage for the key element.
-    void* key = malloc(elem_size);
+    // Storage for the key element.
+    _Alignas(max_align_t) unsigned char stack_key[_INSERTION_SORT_STACK_KEY];
+    void* key = (elem_size <= sizeof(stack_key)) ? stack_key : dsa_allocate(allocator, elem_size);
 
     if (!key)
     {
@@ -28,24 +38,56 @@ dsa_error_code_t dsa_insertion_sort(
     for (size_t current_position = 1; current_position < size; current_position++)
     {
         memcpy(key, &arr[current_position * elem_size], elem_size);
+        DSA_STATS_ADD(moves, 1);
 
         ptrdiff_t insert_position = (ptrdiff_t) current_position - 1;
 
         // Determine the position at which to insert the key element.
-        while (insert_position >= 0 && compare(&arr[(size_t) insert_position * elem_size], key) > 0)
+        while (insert_position >= 0)
         {
             void* source = &arr[(size_t) insert_position * elem_size];
+
+            DSA_STATS_ADD(comparisons, 1);
+            if (compare(source, key) <= 0)
+            {
+                break;
+            }
+
             void* destination = &arr[(size_t)(insert_position + 1) * elem_size];
 
             // Shift element to the right
             memcpy(destination, source, elem_size);
+            DSA_STATS_ADD(moves, 1);
             --insert_position;
         }
 
         // Insert the key at the correct position
         memcpy(&arr[(size_t)(insert_position + 1) * elem_size], key, elem_size);
+        DSA_STATS_ADD(moves, 1);
     }
 
-    free(key);
+    if (key != stack_key)
+    {
+        dsa_deallocate(allocator, key, elem_size);
+    }
     return DSA_SUCCESS;
 }
+
+dsa_error_code_t dsa_insertion_sort_with_allocator(
+    void* const data,
+    const size_t size,
+    const size_t elem_size,
+    int (*compare)(const void* key1, const void* key2),
+    const dsa_allocator_t* allocator)
+{
+    if (!data || !compare || elem_size == 0)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    DSA_TRACE_ENTRY(insertion_sort, size, elem_size);
+    const dsa_error_code_t result = _insertion_sort(data, size, elem_size, compare, allocator);
+    DSA_TRACE_EXIT(insertion_sort, size, elem_size);
+
+    return result;
+}
@@ -0,0 +1,345 @@
+#include "dsa/common/cpu.h"
+#include "dsa/utility/max_element.h"
+#include "dsa/utility/min_element.h"
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #define _KERNELS_HAVE_AVX2 1
+    #include <immintrin.h>
+#endif
+
+// Every typed search first looks for the index of the first non-NaN element and then
+// scans for strictly smaller (or larger) values, so NaNs never win a comparison and the
+// earliest of several equal extremes is kept, exactly as in the generic versions.
+//
+// The AVX2 kernels instead compute the extreme value with packed min/max instructions and
+// then locate its first occurrence with packed equality tests, which yields the same index.
+// Packed min/max return their second operand when either input is NaN, so accumulating
+// as `min(x, acc)` skips NaNs as long as the accumulator starts from a number.
+
+static size_t _scalar_index_f64(const double* arr, const size_t size, const bool find_max)
+{
+    size_t best = 0;
+    while (best < size && isnan(arr[best]))
+    {
+        ++best;
+    }
+    if (best == size)
+    {
+        return 0;
+    }
+
+    for (size_t i = best + 1; i < size; i++)
+    {
+        if (find_max ? arr[i] > arr[best] : arr[i] < arr[best])
+        {
+            best = i;
+        }
+    }
+
+    return best;
+}
+
+static size_t _scalar_index_f32(const float* arr, const size_t size, const bool find_max)
+{
+    size_t best = 0;
+    while (best < size && isnan(arr[best]))
+    {
+        ++best;
+    }
+    if (best == size)
+    {
+        return 0;
+    }
+
+    for (size_t i = best + 1; i < size; i++)
+    {
+        if (find_max ? arr[i] > arr[best] : arr[i] < arr[best])
+        {
+            best = i;
+        }
+    }
+
+    return best;
+}
+
+static size_t _scalar_index_i32(const int32_t* arr, const size_t size, const bool find_max)
+{
+    size_t best = 0;
+
+    for (size_t i = 1; i < size; i++)
+    {
+        if (find_max ? arr[i] > arr[best] : arr[i] < arr[best])
+        {
+            best = i;
+        }
+    }
+
+    return best;
+}
+
+#if defined(_KERNELS_HAVE_AVX2)
+
+__attribute__((target("avx2"))) static size_t _avx2_index_f64(const double* arr, const size_t size, const bool find_max)
+{
+    const double start = find_max ? -INFINITY : INFINITY;
+    __m256d acc = _mm256_set1_pd(start);
+
+    size_t i = 0;
+    for (; i + 4 <= size; i += 4)
+    {
+        const __m256d values = _mm256_loadu_pd(arr + i);
+        acc = find_max ? _mm256_max_pd(values, acc) : _mm256_min_pd(values, acc);
+    }
+
+    double lanes[4];
+    _mm256_storeu_pd(lanes, acc);
+    double extreme = start;
+    for (size_t lane = 0; lane < 4; lane++)
+    {
+        if (find_max ? lanes[lane] > extreme : lanes[lane] < extreme)
+        {
+            extreme = lanes[lane];
+        }
+    }
+    for (size_t j = i; j < size; j++)
+    {
+        if (find_max ? arr[j] > extreme : arr[j] < extreme)
+        {
+            extreme = arr[j];
+        }
+    }
+
+    const __m256d target = _mm256_set1_pd(extreme);
+    for (i = 0; i + 4 <= size; i += 4)
+    {
+        const int mask = _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(arr + i), target, _CMP_EQ_OQ));
+        if (mask)
+        {
+            return i + (size_t)__builtin_ctz((unsigned)mask);
+        }
+    }
+    for (; i < size; i++)
+    {
+        if (arr[i] == extreme)
+        {
+            return i;
+        }
+    }
+
+    // Only NaNs were found.
+    return 0;
+}
+
+__attribute__((target("avx2"))) static size_t _avx2_index_f32(const float* arr, const size_t size, const bool find_max)
+{
+    const float start = find_max ? -INFINITY : INFINITY;
+    __m256 acc = _mm256_set1_ps(start);
+
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8)
+    {
+        const __m256 values = _mm256_loadu_ps(arr + i);
+        acc = find_max ? _mm256_max_ps(values, acc) : _mm256_min_ps(values, acc);
+    }
+
+    float lanes[8];
+    _mm256_storeu_ps(lanes, acc);
+    float extreme = start;
+    for (size_t lane = 0; lane < 8; lane++)
+    {
+        if (find_max ? lanes[lane] > extreme : lanes[lane] < extreme)
+        {
+            extreme = lanes[lane];
+        }
+    }
+    for (size_t j = i; j < size; j++)
+    {
+        if (find_max ? arr[j] > extreme : arr[j] < extreme)
+        {
+            extreme = arr[j];
+        }
+    }
+
+    const __m256 target = _mm256_set1_ps(extreme);
+    for (i = 0; i + 8 <= size; i += 8)
+    {
+        const int mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(arr + i), target, _CMP_EQ_OQ));
+        if (mask)
+        {
+            return i + (size_t)__builtin_ctz((unsigned)mask);
+        }
+    }
+    for (; i < size; i++)
+    {
+        if (arr[i] == extreme)
+        {
+            return i;
+        }
+    }
+
+    // Only NaNs were found.
+    return 0;
+}
+
+__attribute__((target("avx2"))) static size_t _avx2_index_i32(const int32_t* arr, const size_t size, const bool find_max)
+{
+    __m256i acc = _mm256_set1_epi32(arr[0]);
+
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8)
+    {
+        const __m256i values = _mm256_loadu_si256((const __m256i*)(const void*)(arr + i));
+        acc = find_max ? _mm256_max_epi32(values, acc) : _mm256_min_epi32(values, acc);
+    }
+
+    int32_t lanes[8];
+    _mm256_storeu_si256((__m256i*)(void*)lanes, acc);
+    int32_t extreme = arr[0];
+    for (size_t lane = 0; lane < 8; lane++)
+    {
+        if (find_max ? lanes[lane] > extreme : lanes[lane] < extreme)
+        {
+            extreme = lanes[lane];
+        }
+    }
+    for (size_t j = i; j < size; j++)
+    {
+        if (find_max ? arr[j] > extreme : arr[j] < extreme)
+        {
+            extreme = arr[j];
+        }
+    }
+
+    const __m256i target = _mm256_set1_epi32(extreme);
+    for (i = 0; i + 8 <= size; i += 8)
+    {
+        const __m256i values = _mm256_loadu_si256((const __m256i*)(const void*)(arr + i));
+        const int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(values, target)));
+        if (mask)
+        {
+            return i + (size_t)__builtin_ctz((unsigned)mask);
+        }
+    }
+    for (; i < size; i++)
+    {
+        if (arr[i] == extreme)
+        {
+            return i;
+        }
+    }
+
+    return 0;
+}
+
+#endif
+
+// One set of kernels per instruction set level; the level is looked up on every call so that
+// `dsa_cpu_force_level()` takes effect immediately.
+typedef struct
+{
+    size_t (*index_f64)(const double* arr, const size_t size, const bool find_max);
+    size_t (*index_f32)(const float* arr, const size_t size, const bool find_max);
+    size_t (*index_i32)(const int32_t* arr, const size_t size, const bool find_max);
+} _element_kernels_t;
+
+static const _element_kernels_t _scalar_kernels = { _scalar_index_f64, _scalar_index_f32, _scalar_index_i32 };
+
+#if defined(_KERNELS_HAVE_AVX2)
+static const _element_kernels_t _avx2_kernels = { _avx2_index_f64, _avx2_index_f32, _avx2_index_i32 };
+#endif
+
+static const _element_kernels_t* _kernels(void)
+{
+#if defined(_KERNELS_HAVE_AVX2)
+    if (dsa_cpu_get_level() >= DSA_CPU_LEVEL_AVX2)
+    {
+        return &_avx2_kernels;
+    }
+#endif
+    return &_scalar_kernels;
+}
+
+static size_t _index_f64(const double* arr, const size_t size, const bool find_max)
+{
+    return _kernels()->index_f64(arr, size, find_max);
+}
+
+static size_t _index_f32(const float* arr, const size_t size, const bool find_max)
+{
+    return _kernels()->index_f32(arr, size, find_max);
+}
+
+static size_t _index_i32(const int32_t* arr, const size_t size, const bool find_max)
+{
+    return _kernels()->index_i32(arr, size, find_max);
+}
+
+dsa_error_code_t dsa_min_element_index_f64(const double* arr, const size_t size, size_t* min_element_index)
+{
+    if (!arr || size == 0 || !min_element_index)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    *min_element_index = _index_f64(arr, size, false);
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_min_element_index_f32(const float* arr, const size_t size, size_t* min_element_index)
+{
+    if (!arr || size == 0 || !min_element_index)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    *min_element_index = _index_f32(arr, size, false);
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_min_element_index_i32(const int32_t* arr, const size_t size, size_t* min_element_index)
+{
+    if (!arr || size == 0 || !min_element_index)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    *min_element_index = _index_i32(arr, size, false);
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_max_element_index_f64(const double* arr, const size_t size, size_t* max_element_index)
+{
+    if (!arr || size == 0 || !max_element_index)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    *max_element_index = _index_f64(arr, size, true);
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_max_element_index_f32(const float* arr, const size_t size, size_t* max_element_index)
+{
+    if (!arr || size == 0 || !max_element_index)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    *max_element_index = _index_f32(arr, size, true);
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_max_element_index_i32(const int32_t* arr, const size_t size, size_t* max_element_index)
+{
+    if (!arr || size == 0 || !max_element_index)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    *max_element_index = _index_i32(arr, size, true);
+    return DSA_SUCCESS;
+}
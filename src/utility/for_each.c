@@ -1,15 +1,8 @@
 #include "dsa/utility/for_each.h"
 
-typedef struct
-{
-    void (*operation)(void*);
-} dsa_op_wrapper;
-
-static void dsa_forward_operation(void* elem, void* ctx)
-{
-    dsa_op_wrapper* wrapper = (dsa_op_wrapper*)ctx;
-    wrapper->operation(elem);
-}
+// Default span length, in bytes, for dsa_for_each_span(): small enough for a block to
+// stay in the L1 cache while the callback works on it.
+#define _FOR_EACH_SPAN_BYTES 16384
 
 dsa_error_code_t dsa_for_each_ctx(void* arr, const size_t count, const size_t elem_size, dsa_operation_with_context operation, void* ctx)
 {
@@ -31,12 +24,47 @@ dsa_error_code_t dsa_for_each_ctx(void* arr, const size_t count, const size_t el
 
 dsa_error_code_t dsa_for_each(void* arr, const size_t count, const size_t elem_size, dsa_operation_no_context operation)
 {
-    if (!operation)
+    if (!arr || count == 0 || elem_size == 0 || !operation)
     {
         return DSA_INVALID_INPUT;
     }
 
-    dsa_op_wrapper wrapper = { .operation = operation };
+    unsigned char* buffer = arr;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        operation(buffer + i * elem_size);
+    }
+
+    return DSA_SUCCESS;
+}
 
-    return dsa_for_each_ctx(arr, count, elem_size, dsa_forward_operation, &wrapper);
+dsa_error_code_t dsa_for_each_span(void* arr, const size_t count, const size_t elem_size, const size_t span_size,
+                                   dsa_span_operation operation, void* ctx)
+{
+    if (!arr || count == 0 || elem_size == 0 || !operation)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    size_t span = span_size;
+    if (span == 0)
+    {
+        span = (elem_size < _FOR_EACH_SPAN_BYTES) ? _FOR_EACH_SPAN_BYTES / elem_size : 1;
+    }
+
+    unsigned char* buffer = arr;
+
+    for (size_t start = 0; start < count; start += span)
+    {
+        const size_t length = (count - start < span) ? count - start : span;
+        operation(buffer + start * elem_size, length, ctx);
+
+        if (length < span)
+        {
+            break;
+        }
+    }
+
+    return DSA_SUCCESS;
 }
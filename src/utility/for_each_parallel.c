@@ -0,0 +1,135 @@
+#include "dsa/utility/for_each.h"
+#include "dsa/common/allocator.h"
+
+#include <stdatomic.h>
+
+// With the automatic chunk size every worker gets about this many chunks, which keeps the
+// shared counter cold while still letting fast workers take over from slow ones.
+#define _PARALLEL_CHUNKS_PER_WORKER 8
+
+typedef struct
+{
+    unsigned char* base;
+    size_t count;
+    size_t elem_size;
+    size_t chunk_size;
+    dsa_operation_with_context operation;
+    _Atomic size_t next_index;
+} _parallel_job_t;
+
+typedef struct
+{
+    _parallel_job_t* job;
+    void* ctx;
+} _parallel_worker_t;
+
+static void _run_worker(void* arg)
+{
+    _parallel_worker_t* worker = arg;
+    _parallel_job_t* job = worker->job;
+
+    for (;;)
+    {
+        const size_t start = atomic_fetch_add_explicit(&job->next_index, job->chunk_size, memory_order_relaxed);
+        if (start >= job->count)
+        {
+            return;
+        }
+
+        const size_t end = (job->count - start < job->chunk_size) ? job->count : start + job->chunk_size;
+        for (size_t i = start; i < end; i++)
+        {
+            job->operation(job->base + i * job->elem_size, worker->ctx);
+        }
+    }
+}
+
+dsa_error_code_t dsa_for_each_parallel(void* arr, const size_t count, const size_t elem_size, dsa_operation_with_context operation,
+                                       void* ctx, const dsa_parallel_options_t* options)
+{
+    const dsa_parallel_options_t defaults = { 0 };
+    if (!options)
+    {
+        options = &defaults;
+    }
+
+    if (!arr || count == 0 || elem_size == 0 || !operation || (!ctx && !options->thread_ctx) ||
+        (options->thread_ctx && options->num_threads == 0))
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    dsa_executor_t executor = options->executor;
+    if (!executor)
+    {
+        const dsa_error_code_t result = dsa_executor_get_default(&executor);
+        if (result != DSA_SUCCESS)
+        {
+            return result;
+        }
+    }
+
+    size_t num_workers = options->num_threads;
+    if (num_workers == 0)
+    {
+        dsa_executor_get_thread_count(executor, &num_workers);
+        if (num_workers == 0)
+        {
+            num_workers = 1;
+        }
+    }
+
+    size_t chunk_size = options->chunk_size;
+    if (chunk_size == 0)
+    {
+        chunk_size = count / (num_workers * _PARALLEL_CHUNKS_PER_WORKER);
+        if (chunk_size == 0)
+        {
+            chunk_size = 1;
+        }
+    }
+
+    // Never start more workers than there are chunks.
+    const size_t num_chunks = count / chunk_size + (count % chunk_size != 0);
+    if (num_workers > num_chunks)
+    {
+        num_workers = num_chunks;
+    }
+
+    _parallel_job_t job = {
+        .base = arr,
+        .count = count,
+        .elem_size = elem_size,
+        .chunk_size = chunk_size,
+        .operation = operation,
+    };
+    atomic_init(&job.next_index, 0);
+
+    _parallel_worker_t* workers = dsa_allocate(options->allocator, num_workers * sizeof(*workers));
+    if (!workers)
+    {
+        return DSA_ALLOC_FAILURE;
+    }
+
+    for (size_t i = 0; i < num_workers; i++)
+    {
+        workers[i].job = &job;
+        workers[i].ctx = options->thread_ctx ? options->thread_ctx[i] : ctx;
+    }
+
+    dsa_task_group_t group;
+    dsa_task_group_init(&group, executor);
+
+    for (size_t i = 1; i < num_workers; i++)
+    {
+        dsa_task_group_run(&group, _run_worker, &workers[i]);
+    }
+
+    // Worker 0 runs on the calling thread.
+    _run_worker(&workers[0]);
+    dsa_task_group_wait(&group);
+
+    dsa_deallocate(options->allocator, workers, num_workers * sizeof(*workers));
+
+    return DSA_SUCCESS;
+}
@@ -0,0 +1,61 @@
+#include "dsa/utility/minmax_element.h"
+
+dsa_error_code_t dsa_minmax_element_index(
+    const void* arr,
+    const size_t size,
+    const size_t elem_size,
+    int (*compare)(const void* a, const void* b),
+    size_t* min_element_index,
+    size_t* max_element_index)
+{
+    if (!arr || size == 0 || elem_size == 0 || !compare || !min_element_index || !max_element_index)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    const unsigned char* const buffer = arr;
+
+    size_t min_index = 0;
+    size_t max_index = 0;
+
+    size_t i = 1;
+    for (; i + 1 < size; i += 2)
+    {
+        const unsigned char* first = buffer + i * elem_size;
+        const unsigned char* second = buffer + (i + 1) * elem_size;
+
+        // On a tie the earlier element is the candidate for both, which keeps the
+        // first-occurrence rule of min_element.c and max_element.c.
+        const int order = compare(second, first);
+        const size_t smaller = order < 0 ? i + 1 : i;
+        const size_t larger = order > 0 ? i + 1 : i;
+
+        if (compare(buffer + smaller * elem_size, buffer + min_index * elem_size) < 0)
+        {
+            min_index = smaller;
+        }
+        if (compare(buffer + larger * elem_size, buffer + max_index * elem_size) > 0)
+        {
+            max_index = larger;
+        }
+    }
+
+    if (i < size)
+    {
+        const unsigned char* last = buffer + i * elem_size;
+
+        if (compare(last, buffer + min_index * elem_size) < 0)
+        {
+            min_index = i;
+        }
+        if (compare(last, buffer + max_index * elem_size) > 0)
+        {
+            max_index = i;
+        }
+    }
+
+    *min_element_index = min_index;
+    *max_element_index = max_index;
+
+    return DSA_SUCCESS;
+}
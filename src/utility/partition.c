@@ -0,0 +1,184 @@
+#include "dsa/utility/partition.h"
+#include "dsa/utility/rotate.h"
+
+#include <string.h>
+
+// Number of elements classified at once from each end. Offsets within a block fit in a byte.
+#define _PARTITION_BLOCK 64
+#define _PARTITION_SWAP_BUFFER 256
+
+static void _swap_elements(unsigned char* first, unsigned char* second, size_t size)
+{
+    unsigned char temp[_PARTITION_SWAP_BUFFER];
+
+    while (size > 0)
+    {
+        const size_t chunk = size < sizeof(temp) ? size : sizeof(temp);
+
+        memcpy(temp, first, chunk);
+        memcpy(first, second, chunk);
+        memcpy(second, temp, chunk);
+
+        first += chunk;
+        second += chunk;
+        size -= chunk;
+    }
+}
+
+dsa_error_code_t dsa_partition(void* arr, const size_t count, const size_t elem_size,
+                               dsa_predicate_func predicate, void* ctx, size_t* partition_point)
+{
+    if (!arr || count == 0 || elem_size == 0 || !predicate || !partition_point)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    unsigned char* buffer = arr;
+
+    // Invariant: elements before `left` satisfy the predicate, elements from `right` on do not.
+    size_t left = 0;
+    size_t right = count;
+
+    unsigned char offsets_left[_PARTITION_BLOCK];
+    unsigned char offsets_right[_PARTITION_BLOCK];
+    size_t first_left = 0;
+    size_t first_right = 0;
+    size_t num_left = 0;
+    size_t num_right = 0;
+
+    while (right - left >= 2 * _PARTITION_BLOCK)
+    {
+        // Record the offsets of misplaced elements. The offset is always written and the
+        // count only advanced for misplaced ones, so there is no branch on the predicate.
+        if (num_left == 0)
+        {
+            first_left = 0;
+            for (size_t i = 0; i < _PARTITION_BLOCK; i++)
+            {
+                offsets_left[num_left] = (unsigned char)i;
+                num_left += (size_t)!predicate(buffer + (left + i) * elem_size, ctx);
+            }
+        }
+
+        if (num_right == 0)
+        {
+            first_right = 0;
+            for (size_t i = 0; i < _PARTITION_BLOCK; i++)
+            {
+                offsets_right[num_right] = (unsigned char)i;
+                num_right += (size_t)predicate(buffer + (right - 1 - i) * elem_size, ctx);
+            }
+        }
+
+        const size_t pairs = num_left < num_right ? num_left : num_right;
+        for (size_t k = 0; k < pairs; k++)
+        {
+            _swap_elements(buffer + (left + offsets_left[first_left + k]) * elem_size,
+                           buffer + (right - 1 - offsets_right[first_right + k]) * elem_size,
+                           elem_size);
+        }
+
+        first_left += pairs;
+        first_right += pairs;
+        num_left -= pairs;
+        num_right -= pairs;
+
+        if (num_left == 0)
+        {
+            left += _PARTITION_BLOCK;
+        }
+        if (num_right == 0)
+        {
+            right -= _PARTITION_BLOCK;
+        }
+    }
+
+    // Fewer than two blocks remain; finish with a classic Hoare scan.
+    for (;;)
+    {
+        while (left < right && predicate(buffer + left * elem_size, ctx))
+        {
+            ++left;
+        }
+        while (left < right && !predicate(buffer + (right - 1) * elem_size, ctx))
+        {
+            --right;
+        }
+        if (left >= right)
+        {
+            break;
+        }
+
+        _swap_elements(buffer + left * elem_size, buffer + (right - 1) * elem_size, elem_size);
+        ++left;
+        --right;
+    }
+
+    *partition_point = left;
+    return DSA_SUCCESS;
+}
+
+static size_t _stable_partition(unsigned char* buffer, const size_t count, const size_t elem_size,
+                                dsa_predicate_func predicate, void* ctx,
+                                unsigned char* scratch, const size_t scratch_count)
+{
+    if (count <= scratch_count)
+    {
+        size_t kept = 0;
+        size_t spilled = 0;
+
+        for (size_t i = 0; i < count; i++)
+        {
+            unsigned char* current = buffer + i * elem_size;
+            if (predicate(current, ctx))
+            {
+                if (kept != i)
+                {
+                    memcpy(buffer + kept * elem_size, current, elem_size);
+                }
+                ++kept;
+            }
+            else
+            {
+                memcpy(scratch + spilled * elem_size, current, elem_size);
+                ++spilled;
+            }
+        }
+
+        if (spilled > 0)
+        {
+            memcpy(buffer + kept * elem_size, scratch, spilled * elem_size);
+        }
+        return kept;
+    }
+
+    if (count == 1)
+    {
+        return predicate(buffer, ctx) ? 1 : 0;
+    }
+
+    const size_t half = count / 2;
+    const size_t left_kept = _stable_partition(buffer, half, elem_size, predicate, ctx, scratch, scratch_count);
+    const size_t right_kept = _stable_partition(buffer + half * elem_size, count - half, elem_size, predicate, ctx, scratch, scratch_count);
+
+    // [kept L | rest L | kept R | rest R] -> [kept L | kept R | rest L | rest R]
+    if (right_kept > 0 && left_kept < half)
+    {
+        dsa_rotate(buffer + left_kept * elem_size, half - left_kept + right_kept, elem_size, half - left_kept);
+    }
+
+    return left_kept + right_kept;
+}
+
+dsa_error_code_t dsa_stable_partition(void* arr, const size_t count, const size_t elem_size,
+                                      dsa_predicate_func predicate, void* ctx,
+                                      void* scratch, const size_t scratch_count, size_t* partition_point)
+{
+    if (!arr || count == 0 || elem_size == 0 || !predicate || !partition_point)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    *partition_point = _stable_partition(arr, count, elem_size, predicate, ctx, scratch, scratch ? scratch_count : 0);
+    return DSA_SUCCESS;
+}
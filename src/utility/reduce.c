@@ -0,0 +1,136 @@
+#include "dsa/utility/reduce.h"
+#include "dsa/utility/max_element.h"
+#include "dsa/utility/min_element.h"
+
+// Number of independent accumulators in the typed sums. Breaking the dependency chain
+// lets the compiler keep them in vector registers.
+#define _REDUCE_LANES 8
+
+dsa_error_code_t dsa_reduce(const void* arr, const size_t count, const size_t elem_size, void* result, dsa_combine_func combine, void* ctx)
+{
+    if (!arr || count == 0 || elem_size == 0 || !result || !combine)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    const unsigned char* buffer = arr;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        combine(result, buffer + i * elem_size, ctx);
+    }
+
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_reduce_sum_i32(const int32_t* arr, const size_t count, int64_t* result)
+{
+    if (!arr || count == 0 || !result)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    int64_t lanes[_REDUCE_LANES] = { 0 };
+
+    size_t i = 0;
+    for (; i + _REDUCE_LANES <= count; i += _REDUCE_LANES)
+    {
+        for (size_t lane = 0; lane < _REDUCE_LANES; lane++)
+        {
+            lanes[lane] += arr[i + lane];
+        }
+    }
+
+    int64_t sum = 0;
+    for (size_t lane = 0; lane < _REDUCE_LANES; lane++)
+    {
+        sum += lanes[lane];
+    }
+    for (; i < count; i++)
+    {
+        sum += arr[i];
+    }
+
+    *result = sum;
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_reduce_sum_f64(const double* arr, const size_t count, double* result)
+{
+    if (!arr || count == 0 || !result)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    double lanes[_REDUCE_LANES] = { 0.0 };
+
+    size_t i = 0;
+    for (; i + _REDUCE_LANES <= count; i += _REDUCE_LANES)
+    {
+        for (size_t lane = 0; lane < _REDUCE_LANES; lane++)
+        {
+            lanes[lane] += arr[i + lane];
+        }
+    }
+
+    double sum = 0.0;
+    for (size_t lane = 0; lane < _REDUCE_LANES; lane++)
+    {
+        sum += lanes[lane];
+    }
+    for (; i < count; i++)
+    {
+        sum += arr[i];
+    }
+
+    *result = sum;
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_reduce_min_i32(const int32_t* arr, const size_t count, int32_t* result)
+{
+    size_t index = 0;
+    if (!result || dsa_min_element_index_i32(arr, count, &index) != DSA_SUCCESS)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    *result = arr[index];
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_reduce_max_i32(const int32_t* arr, const size_t count, int32_t* result)
+{
+    size_t index = 0;
+    if (!result || dsa_max_element_index_i32(arr, count, &index) != DSA_SUCCESS)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    *result = arr[index];
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_reduce_min_f64(const double* arr, const size_t count, double* result)
+{
+    size_t index = 0;
+    if (!result || dsa_min_element_index_f64(arr, count, &index) != DSA_SUCCESS)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    *result = arr[index];
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_reduce_max_f64(const double* arr, const size_t count, double* result)
+{
+    size_t index = 0;
+    if (!result || dsa_max_element_index_f64(arr, count, &index) != DSA_SUCCESS)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    *result = arr[index];
+    return DSA_SUCCESS;
+}
@@ -0,0 +1,33 @@
+#include "dsa/utility/remove_if.h"
+
+#include <string.h>
+
+dsa_error_code_t dsa_remove_if(void* arr, const size_t count, const size_t elem_size,
+                               dsa_predicate_func predicate, void* ctx, size_t* new_count)
+{
+    if (!arr || count == 0 || elem_size == 0 || !predicate || !new_count)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    unsigned char* buffer = arr;
+
+    size_t kept = 0;
+    while (kept < count && !predicate(buffer + kept * elem_size, ctx))
+    {
+        ++kept;
+    }
+
+    for (size_t i = kept + 1; i < count; i++)
+    {
+        unsigned char* current = buffer + i * elem_size;
+        if (!predicate(current, ctx))
+        {
+            memcpy(buffer + kept * elem_size, current, elem_size);
+            ++kept;
+        }
+    }
+
+    *new_count = kept;
+    return DSA_SUCCESS;
+}
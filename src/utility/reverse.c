@@ -1,38 +1,284 @@
+#include "dsa/common/cpu.h"
 #include "dsa/utility/reverse.h"
 
-#include <stdlib.h>
+#include <stdint.h>
 #include <string.h>
 
-dsa_error_code_t dsa_reverse(void* const arr, const size_t count, const size_t elem_size)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define _REVERSE_USE_SSE2 1
+    #include <emmintrin.h>
+#endif
+
+// Arrays of 1, 2, 4, 8 or 16 byte elements are reversed a 16-byte block at a time: a block
+// from each end is loaded, the order of the elements inside it is reversed with a few
+// shuffles, and the two blocks are stored at each other's position. The blocks are SSE2
+// registers where the processor has them, and pairs of 64-bit words everywhere else.
+#define _REVERSE_BLOCK 16
+
+// Larger elements are swapped piecewise through a stack buffer of this size.
+#define _REVERSE_SWAP_BUFFER 256
+
+typedef struct
 {
-    if (!arr || count == 0 || elem_size == 0)
+    uint64_t words[2];
+} _swar_block_t;
+
+static inline uint64_t _byte_swap64(const uint64_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap64(value);
+#else
+    uint64_t result = 0;
+    for (unsigned i = 0; i < 8; i++)
     {
-        return DSA_INVALID_INPUT;
+        result |= ((value >> (8 * i)) & 0xFFu) << (56 - 8 * i);
     }
+    return result;
+#endif
+}
 
-    unsigned char* buffer = arr;
-    unsigned char* temp = malloc(elem_size);
-    if (!temp)
+// Reversing the order of the lanes of an integer reverses their order in memory
+// regardless of the platform's endianness.
+static inline uint64_t _reverse_lanes64(uint64_t word, const size_t elem_size)
+{
+    switch (elem_size)
     {
-        return DSA_ALLOC_FAILURE;
+    case 1:
+        return _byte_swap64(word);
+    case 2:
+        word = ((word & UINT64_C(0x0000FFFF0000FFFF)) << 16) | ((word >> 16) & UINT64_C(0x0000FFFF0000FFFF));
+        return (word << 32) | (word >> 32);
+    case 4:
+        return (word << 32) | (word >> 32);
+    default:
+        return word;
     }
+}
+
+static inline _swar_block_t _swar_load(const unsigned char* src)
+{
+    _swar_block_t block;
+    memcpy(block.words, src, sizeof(block.words));
+    return block;
+}
+
+static inline void _swar_store(unsigned char* dst, const _swar_block_t block)
+{
+    memcpy(dst, block.words, sizeof(block.words));
+}
+
+static inline _swar_block_t _swar_reverse(const _swar_block_t block, const size_t elem_size)
+{
+    if (elem_size == 16)
+    {
+        return block;
+    }
+
+    const _swar_block_t reversed = { { _reverse_lanes64(block.words[1], elem_size), _reverse_lanes64(block.words[0], elem_size) } };
+    return reversed;
+}
+
+#if defined(_REVERSE_USE_SSE2)
 
-    size_t begin = 0;
-    size_t end = count - 1;
+typedef __m128i _sse2_block_t;
+
+static inline _sse2_block_t _sse2_load(const unsigned char* src)
+{
+    return _mm_loadu_si128((const __m128i*)(const void*)src);
+}
+
+static inline void _sse2_store(unsigned char* dst, const _sse2_block_t block)
+{
+    _mm_storeu_si128((__m128i*)(void*)dst, block);
+}
+
+static inline _sse2_block_t _sse2_reverse(_sse2_block_t block, const size_t elem_size)
+{
+    switch (elem_size)
+    {
+    case 1:
+        block = _mm_or_si128(_mm_slli_epi16(block, 8), _mm_srli_epi16(block, 8));
+        block = _mm_shufflelo_epi16(block, _MM_SHUFFLE(0, 1, 2, 3));
+        block = _mm_shufflehi_epi16(block, _MM_SHUFFLE(0, 1, 2, 3));
+        return _mm_shuffle_epi32(block, _MM_SHUFFLE(1, 0, 3, 2));
+    case 2:
+        block = _mm_shufflelo_epi16(block, _MM_SHUFFLE(0, 1, 2, 3));
+        block = _mm_shufflehi_epi16(block, _MM_SHUFFLE(0, 1, 2, 3));
+        return _mm_shuffle_epi32(block, _MM_SHUFFLE(1, 0, 3, 2));
+    case 4:
+        return _mm_shuffle_epi32(block, _MM_SHUFFLE(0, 1, 2, 3));
+    case 8:
+        return _mm_shuffle_epi32(block, _MM_SHUFFLE(1, 0, 3, 2));
+    default:
+        return block;
+    }
+}
+
+#endif
+
+static void _swap_bytes(unsigned char* first, unsigned char* second, size_t size)
+{
+    unsigned char temp[_REVERSE_SWAP_BUFFER];
+
+    while (size > 0)
+    {
+        const size_t chunk = size < sizeof(temp) ? size : sizeof(temp);
+
+        memcpy(temp, first, chunk);
+        memcpy(first, second, chunk);
+        memcpy(second, temp, chunk);
+
+        first += chunk;
+        second += chunk;
+        size -= chunk;
+    }
+}
+
+static void _reverse_elements(unsigned char* buffer, const size_t count, const size_t elem_size)
+{
+    if (count < 2)
+    {
+        return;
+    }
+
+    unsigned char* begin = buffer;
+    unsigned char* end = buffer + (count - 1) * elem_size;
 
     while (begin < end)
     {
-        unsigned char* const begin_ptr = buffer + begin * elem_size;
-        unsigned char* const end_ptr = buffer + end * elem_size;
+        _swap_bytes(begin, end, elem_size);
+        begin += elem_size;
+        end -= elem_size;
+    }
+}
+
+static inline void _reverse_blocks_swar(unsigned char* buffer, const size_t count, const size_t elem_size)
+{
+    unsigned char* front = buffer;
+    unsigned char* back = buffer + count * elem_size;
+
+    while ((size_t)(back - front) >= 2 * _REVERSE_BLOCK)
+    {
+        back -= _REVERSE_BLOCK;
+
+        const _swar_block_t front_block = _swar_load(front);
+        const _swar_block_t back_block = _swar_load(back);
+        _swar_store(front, _swar_reverse(back_block, elem_size));
+        _swar_store(back, _swar_reverse(front_block, elem_size));
+
+        front += _REVERSE_BLOCK;
+    }
+
+    // Less than two blocks remain in the middle.
+    _reverse_elements(front, (size_t)(back - front) / elem_size, elem_size);
+}
+
+// Constant sizes let the compiler specialize the block loop for each element size.
+static void _reverse_sized_swar(unsigned char* buffer, const size_t count, const size_t elem_size)
+{
+    switch (elem_size)
+    {
+    case 1:
+        _reverse_blocks_swar(buffer, count, 1);
+        break;
+    case 2:
+        _reverse_blocks_swar(buffer, count, 2);
+        break;
+    case 4:
+        _reverse_blocks_swar(buffer, count, 4);
+        break;
+    case 8:
+        _reverse_blocks_swar(buffer, count, 8);
+        break;
+    default:
+        _reverse_blocks_swar(buffer, count, 16);
+        break;
+    }
+}
+
+#if defined(_REVERSE_USE_SSE2)
+
+static inline void _reverse_blocks_sse2(unsigned char* buffer, const size_t count, const size_t elem_size)
+{
+    unsigned char* front = buffer;
+    unsigned char* back = buffer + count * elem_size;
+
+    while ((size_t)(back - front) >= 2 * _REVERSE_BLOCK)
+    {
+        back -= _REVERSE_BLOCK;
+
+        const _sse2_block_t front_block = _sse2_load(front);
+        const _sse2_block_t back_block = _sse2_load(back);
+        _sse2_store(front, _sse2_reverse(back_block, elem_size));
+        _sse2_store(back, _sse2_reverse(front_block, elem_size));
+
+        front += _REVERSE_BLOCK;
+    }
+
+    // Less than two blocks remain in the middle.
+    _reverse_elements(front, (size_t)(back - front) / elem_size, elem_size);
+}
+
+// Constant sizes let the compiler specialize the block loop for each element size.
+static void _reverse_sized_sse2(unsigned char* buffer, const size_t count, const size_t elem_size)
+{
+    switch (elem_size)
+    {
+    case 1:
+        _reverse_blocks_sse2(buffer, count, 1);
+        break;
+    case 2:
+        _reverse_blocks_sse2(buffer, count, 2);
+        break;
+    case 4:
+        _reverse_blocks_sse2(buffer, count, 4);
+        break;
+    case 8:
+        _reverse_blocks_sse2(buffer, count, 8);
+        break;
+    default:
+        _reverse_blocks_sse2(buffer, count, 16);
+        break;
+    }
+}
+
+#endif
+
+typedef void (*_reverse_kernel_t)(unsigned char* buffer, const size_t count, const size_t elem_size);
+
+static _reverse_kernel_t _kernel(void)
+{
+#if defined(_REVERSE_USE_SSE2)
+    if (dsa_cpu_get_level() >= DSA_CPU_LEVEL_SSE2)
+    {
+        return _reverse_sized_sse2;
+    }
+#endif
+    return _reverse_sized_swar;
+}
+
+dsa_error_code_t dsa_reverse(void* const arr, const size_t count, const size_t elem_size)
+{
+    if (!arr || count == 0 || elem_size == 0)
+    {
+        return DSA_INVALID_INPUT;
+    }
 
-        memcpy(temp, end_ptr, elem_size);
-        memcpy(end_ptr, begin_ptr, elem_size);
-        memcpy(begin_ptr, temp, elem_size);
+    unsigned char* buffer = arr;
 
-        ++begin;
-        --end;
+    switch (elem_size)
+    {
+    case 1:
+    case 2:
+    case 4:
+    case 8:
+    case 16:
+        _kernel()(buffer, count, elem_size);
+        break;
+    default:
+        _reverse_elements(buffer, count, elem_size);
+        break;
     }
 
-    free(temp);
     return DSA_SUCCESS;
 }
@@ -0,0 +1,141 @@
+#include "dsa/utility/rotate.h"
+
+#include <string.h>
+
+// The shorter part is buffered on the stack if it is at most this large.
+#define _ROTATE_BUFFER 512
+
+// Arrays up to this size are assumed to stay in the L1 cache, where the scattered
+// accesses of the juggling algorithm are cheap.
+#define _ROTATE_CACHE_BYTES 32768
+
+static void _swap_ranges(unsigned char* first, unsigned char* second, size_t size)
+{
+    unsigned char temp[_ROTATE_BUFFER];
+
+    while (size > 0)
+    {
+        const size_t chunk = size < sizeof(temp) ? size : sizeof(temp);
+
+        memcpy(temp, first, chunk);
+        memcpy(first, second, chunk);
+        memcpy(second, temp, chunk);
+
+        first += chunk;
+        second += chunk;
+        size -= chunk;
+    }
+}
+
+static size_t _gcd(size_t a, size_t b)
+{
+    while (b != 0)
+    {
+        const size_t remainder = a % b;
+        a = b;
+        b = remainder;
+    }
+    return a;
+}
+
+static void _rotate_buffered(unsigned char* buffer, const size_t left_bytes, const size_t right_bytes)
+{
+    unsigned char temp[_ROTATE_BUFFER];
+
+    if (left_bytes <= right_bytes)
+    {
+        memcpy(temp, buffer, left_bytes);
+        memmove(buffer, buffer + left_bytes, right_bytes);
+        memcpy(buffer + right_bytes, temp, left_bytes);
+    }
+    else
+    {
+        memcpy(temp, buffer + left_bytes, right_bytes);
+        memmove(buffer + right_bytes, buffer, left_bytes);
+        memcpy(buffer, temp, right_bytes);
+    }
+}
+
+// Requires elem_size <= _ROTATE_BUFFER.
+static void _rotate_juggling(unsigned char* buffer, const size_t count, const size_t elem_size, const size_t middle)
+{
+    unsigned char temp[_ROTATE_BUFFER];
+    const size_t cycles = _gcd(count, middle);
+
+    for (size_t start = 0; start < cycles; start++)
+    {
+        memcpy(temp, buffer + start * elem_size, elem_size);
+
+        size_t hole = start;
+        for (;;)
+        {
+            size_t next = hole + middle;
+            if (next >= count)
+            {
+                next -= count;
+            }
+            if (next == start)
+            {
+                break;
+            }
+
+            memcpy(buffer + hole * elem_size, buffer + next * elem_size, elem_size);
+            hole = next;
+        }
+
+        memcpy(buffer + hole * elem_size, temp, elem_size);
+    }
+}
+
+static void _rotate_block_swap(unsigned char* buffer, size_t left, size_t right, const size_t elem_size)
+{
+    // The range starting at `buffer` is A (`left` elements) followed by B (`right` elements).
+    while (left != 0 && right != 0)
+    {
+        if (left <= right)
+        {
+            // A B1 B2 with |B2| = |A|  ->  B2 B1 A: A is final, rotate B2 B1 next.
+            _swap_ranges(buffer, buffer + right * elem_size, left * elem_size);
+            right -= left;
+        }
+        else
+        {
+            // A1 A2 B with |A1| = |B|  ->  B A2 A1: B is final, rotate A2 A1 next.
+            _swap_ranges(buffer, buffer + left * elem_size, right * elem_size);
+            buffer += right * elem_size;
+            left -= right;
+        }
+    }
+}
+
+dsa_error_code_t dsa_rotate(void* arr, const size_t count, const size_t elem_size, const size_t middle)
+{
+    if (!arr || count == 0 || elem_size == 0 || middle > count)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    if (middle == 0 || middle == count)
+    {
+        return DSA_SUCCESS;
+    }
+
+    unsigned char* buffer = arr;
+    const size_t left_bytes = middle * elem_size;
+    const size_t right_bytes = (count - middle) * elem_size;
+
+    if (left_bytes <= _ROTATE_BUFFER || right_bytes <= _ROTATE_BUFFER)
+    {
+        _rotate_buffered(buffer, left_bytes, right_bytes);
+    }
+    else if (left_bytes + right_bytes <= _ROTATE_CACHE_BYTES && elem_size <= _ROTATE_BUFFER)
+    {
+        _rotate_juggling(buffer, count, elem_size, middle);
+    }
+    else
+    {
+        _rotate_block_swap(buffer, middle, count - middle, elem_size);
+    }
+
+    return DSA_SUCCESS;
+}
@@ -0,0 +1,368 @@
+#include "dsa/utility/scan.h"
+#include "dsa/common/allocator.h"
+#include "dsa/common/thread.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// Inputs shorter than this are always scanned sequentially: starting the workers costs
+// more than the scan itself. Parallel blocks are never shorter than _SCAN_MIN_BLOCK.
+#define _SCAN_PARALLEL_THRESHOLD ((size_t)1 << 16)
+#define _SCAN_MIN_BLOCK ((size_t)1 << 12)
+
+typedef enum
+{
+    _SCAN_F64,
+    _SCAN_I64,
+} _scan_type_t;
+
+typedef union
+{
+    double f64;
+    int64_t i64;
+} _scan_value_t;
+
+// One contiguous block of a parallel scan. Pass one stores the block's total, pass two
+// scans the block starting from `offset`, the combined total of all preceding blocks.
+typedef struct
+{
+    const void* in;
+    void* out;
+    size_t count;
+    _scan_type_t type;
+    bool exclusive;
+    _scan_value_t total;
+    _scan_value_t offset;
+} _scan_block_t;
+
+static _scan_value_t _sum_block(const _scan_block_t* block)
+{
+    _scan_value_t total = { 0 };
+
+    if (block->type == _SCAN_F64)
+    {
+        const double* in = block->in;
+        double sum = 0.0;
+        for (size_t i = 0; i < block->count; i++)
+        {
+            sum += in[i];
+        }
+        total.f64 = sum;
+    }
+    else
+    {
+        const int64_t* in = block->in;
+        int64_t sum = 0;
+        for (size_t i = 0; i < block->count; i++)
+        {
+            sum += in[i];
+        }
+        total.i64 = sum;
+    }
+
+    return total;
+}
+
+static void _scan_block(const _scan_block_t* block)
+{
+    if (block->type == _SCAN_F64)
+    {
+        const double* in = block->in;
+        double* out = block->out;
+        double acc = block->offset.f64;
+        for (size_t i = 0; i < block->count; i++)
+        {
+            // Read before writing, so that in-place scans work.
+            const double value = in[i];
+            if (block->exclusive)
+            {
+                out[i] = acc;
+                acc += value;
+            }
+            else
+            {
+                acc += value;
+                out[i] = acc;
+            }
+        }
+    }
+    else
+    {
+        const int64_t* in = block->in;
+        int64_t* out = block->out;
+        int64_t acc = block->offset.i64;
+        for (size_t i = 0; i < block->count; i++)
+        {
+            const int64_t value = in[i];
+            if (block->exclusive)
+            {
+                out[i] = acc;
+                acc += value;
+            }
+            else
+            {
+                acc += value;
+                out[i] = acc;
+            }
+        }
+    }
+}
+
+static void _sum_pass(void* elem, void* ctx)
+{
+    (void)ctx;
+    _scan_block_t* block = elem;
+    block->total = _sum_block(block);
+}
+
+static void _scan_pass(void* elem, void* ctx)
+{
+    (void)ctx;
+    _scan_block(elem);
+}
+
+static dsa_error_code_t _scan_sequential(const void* in, void* out, const size_t count, const _scan_type_t type,
+                                         const bool exclusive, const _scan_value_t init)
+{
+    const _scan_block_t whole = { .in = in, .out = out, .count = count, .type = type, .exclusive = exclusive, .offset = init };
+    _scan_block(&whole);
+    return DSA_SUCCESS;
+}
+
+static dsa_error_code_t _scan_sum(const void* in, void* out, const size_t count, const _scan_type_t type, const bool exclusive,
+                                  const _scan_value_t init, const dsa_parallel_options_t* options)
+{
+    const size_t value_size = (type == _SCAN_F64) ? sizeof(double) : sizeof(int64_t);
+    size_t num_blocks = (options && options->num_threads) ? options->num_threads : dsa_thread_hardware_concurrency();
+
+    if (num_blocks > count / _SCAN_MIN_BLOCK)
+    {
+        num_blocks = count / _SCAN_MIN_BLOCK;
+    }
+
+    const dsa_allocator_t* allocator = options ? options->allocator : NULL;
+    _scan_block_t* blocks = NULL;
+    if (num_blocks > 1 && count >= _SCAN_PARALLEL_THRESHOLD)
+    {
+        blocks = dsa_allocate(allocator, num_blocks * sizeof(*blocks));
+    }
+
+    // A sequential scan is always possible, so a failed allocation is not an error.
+    if (!blocks)
+    {
+        return _scan_sequential(in, out, count, type, exclusive, init);
+    }
+
+    const size_t block_size = count / num_blocks;
+    for (size_t i = 0; i < num_blocks; i++)
+    {
+        const size_t start = i * block_size;
+        blocks[i].in = (const unsigned char*)in + start * value_size;
+        blocks[i].out = (unsigned char*)out + start * value_size;
+        blocks[i].count = (i + 1 == num_blocks) ? count - start : block_size;
+        blocks[i].type = type;
+        blocks[i].exclusive = exclusive;
+    }
+
+    const dsa_parallel_options_t pass_options = {
+        .num_threads = num_blocks,
+        .chunk_size = 1,
+        .executor = options ? options->executor : NULL,
+        .allocator = allocator,
+    };
+    int unused = 0;
+
+    // The last block's total is never needed. Both passes fail only before any block is
+    // processed, and the first one writes nothing to `out`, so the sequential scan can
+    // still take over the whole range.
+    dsa_error_code_t result = dsa_for_each_parallel(blocks, num_blocks - 1, sizeof(*blocks), _sum_pass, &unused, &pass_options);
+
+    _scan_value_t offset = init;
+    for (size_t i = 0; result == DSA_SUCCESS && i < num_blocks; i++)
+    {
+        blocks[i].offset = offset;
+        if (i + 1 == num_blocks)
+        {
+            break;
+        }
+
+        if (type == _SCAN_F64)
+        {
+            offset.f64 += blocks[i].total.f64;
+        }
+        else
+        {
+            offset.i64 += blocks[i].total.i64;
+        }
+    }
+
+    if (result == DSA_SUCCESS)
+    {
+        result = dsa_for_each_parallel(blocks, num_blocks, sizeof(*blocks), _scan_pass, &unused, &pass_options);
+    }
+
+    dsa_deallocate(allocator, blocks, num_blocks * sizeof(*blocks));
+
+    if (result != DSA_SUCCESS)
+    {
+        return _scan_sequential(in, out, count, type, exclusive, init);
+    }
+
+    return DSA_SUCCESS;
+}
+
+// Generic scans keep their accumulator in a temporary element, so that the output may
+// alias the input. Temporaries of up to this many bytes live on the stack: the inclusive
+// scan's accumulator for elements up to 128 bytes, and the exclusive scan's accumulator and
+// previous value for elements up to 64 bytes.
+#define _SCAN_STACK_BYTES 128
+
+static unsigned char* _acquire_temp(unsigned char* stack, const size_t size, const dsa_allocator_t* allocator)
+{
+    return size <= _SCAN_STACK_BYTES ? stack : dsa_allocate(allocator, size);
+}
+
+static void _release_temp(unsigned char* temp, const unsigned char* stack, const size_t size, const dsa_allocator_t* allocator)
+{
+    if (temp != stack)
+    {
+        dsa_deallocate(allocator, temp, size);
+    }
+}
+
+dsa_error_code_t dsa_inclusive_scan(const void* in, void* out, const size_t count, const size_t elem_size,
+                                    dsa_combine_func combine, void* ctx)
+{
+    return dsa_inclusive_scan_with_allocator(in, out, count, elem_size, combine, ctx, NULL);
+}
+
+dsa_error_code_t dsa_inclusive_scan_with_allocator(const void* in, void* out, const size_t count, const size_t elem_size,
+                                                   dsa_combine_func combine, void* ctx, const dsa_allocator_t* allocator)
+{
+    if (!in || !out || count == 0 || elem_size == 0 || !combine)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    // The accumulator is passed to `combine`, which may access it through any object type.
+    _Alignas(max_align_t) unsigned char stack[_SCAN_STACK_BYTES];
+    unsigned char* acc = _acquire_temp(stack, elem_size, allocator);
+    if (!acc)
+    {
+        return DSA_ALLOC_FAILURE;
+    }
+
+    const unsigned char* source = in;
+    unsigned char* destination = out;
+
+    memcpy(acc, source, elem_size);
+    memmove(destination, acc, elem_size);
+
+    for (size_t i = 1; i < count; i++)
+    {
+        combine(acc, source + i * elem_size, ctx);
+        memcpy(destination + i * elem_size, acc, elem_size);
+    }
+
+    _release_temp(acc, stack, elem_size, allocator);
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_exclusive_scan(const void* in, void* out, const size_t count, const size_t elem_size,
+                                    const void* init, dsa_combine_func combine, void* ctx)
+{
+    return dsa_exclusive_scan_with_allocator(in, out, count, elem_size, init, combine, ctx, NULL);
+}
+
+dsa_error_code_t dsa_exclusive_scan_with_allocator(const void* in, void* out, const size_t count, const size_t elem_size,
+                                                   const void* init, dsa_combine_func combine, void* ctx,
+                                                   const dsa_allocator_t* allocator)
+{
+    if (!in || !out || count == 0 || elem_size == 0 || !init || !combine)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    // Both temporaries are passed to `combine`, so the second one starts at an aligned offset too.
+    const size_t alignment = _Alignof(max_align_t);
+    if (elem_size > (SIZE_MAX - alignment) / 2)
+    {
+        return DSA_ALLOC_FAILURE;
+    }
+
+    const size_t stride = (elem_size + alignment - 1) / alignment * alignment;
+    const size_t temp_size = stride + elem_size;
+
+    _Alignas(max_align_t) unsigned char stack[_SCAN_STACK_BYTES];
+    unsigned char* temp = _acquire_temp(stack, temp_size, allocator);
+    if (!temp)
+    {
+        return DSA_ALLOC_FAILURE;
+    }
+
+    unsigned char* acc = temp;
+    unsigned char* previous = temp + stride;
+    const unsigned char* source = in;
+    unsigned char* destination = out;
+
+    memcpy(acc, init, elem_size);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        // The input element is consumed before its slot is overwritten.
+        memcpy(previous, acc, elem_size);
+        combine(acc, source + i * elem_size, ctx);
+        memcpy(destination + i * elem_size, previous, elem_size);
+    }
+
+    _release_temp(temp, stack, temp_size, allocator);
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_inclusive_scan_sum_f64(const double* in, double* out, const size_t count, const dsa_parallel_options_t* options)
+{
+    if (!in || !out || count == 0)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    const _scan_value_t init = { .f64 = 0.0 };
+    return _scan_sum(in, out, count, _SCAN_F64, false, init, options);
+}
+
+dsa_error_code_t dsa_inclusive_scan_sum_i64(const int64_t* in, int64_t* out, const size_t count, const dsa_parallel_options_t* options)
+{
+    if (!in || !out || count == 0)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    const _scan_value_t init = { .i64 = 0 };
+    return _scan_sum(in, out, count, _SCAN_I64, false, init, options);
+}
+
+dsa_error_code_t dsa_exclusive_scan_sum_f64(const double* in, double* out, const size_t count, const double init,
+                                            const dsa_parallel_options_t* options)
+{
+    if (!in || !out || count == 0)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    const _scan_value_t start = { .f64 = init };
+    return _scan_sum(in, out, count, _SCAN_F64, true, start, options);
+}
+
+dsa_error_code_t dsa_exclusive_scan_sum_i64(const int64_t* in, int64_t* out, const size_t count, const int64_t init,
+                                            const dsa_parallel_options_t* options)
+{
+    if (!in || !out || count == 0)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    const _scan_value_t start = { .i64 = init };
+    return _scan_sum(in, out, count, _SCAN_I64, true, start, options);
+}
@@ -0,0 +1,20 @@
+#include "dsa/utility/transform.h"
+
+dsa_error_code_t dsa_transform(const void* in, const size_t count, const size_t in_elem_size,
+                               void* out, const size_t out_elem_size, dsa_transform_func func, void* ctx)
+{
+    if (!in || count == 0 || in_elem_size == 0 || !out || out_elem_size == 0 || !func)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    const unsigned char* source = in;
+    unsigned char* destination = out;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        func(destination + i * out_elem_size, source + i * in_elem_size, ctx);
+    }
+
+    return DSA_SUCCESS;
+}
@@ -0,0 +1,32 @@
+#include "dsa/utility/unique.h"
+
+#include <string.h>
+
+dsa_error_code_t dsa_unique(void* arr, const size_t count, const size_t elem_size,
+                            int (*compare)(const void* a, const void* b), size_t* new_count)
+{
+    if (!arr || count == 0 || elem_size == 0 || !compare || !new_count)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    unsigned char* buffer = arr;
+
+    // `last` is the index of the most recently kept element.
+    size_t last = 0;
+    for (size_t i = 1; i < count; i++)
+    {
+        unsigned char* current = buffer + i * elem_size;
+        if (compare(buffer + last * elem_size, current) != 0)
+        {
+            ++last;
+            if (last != i)
+            {
+                memcpy(buffer + last * elem_size, current, elem_size);
+            }
+        }
+    }
+
+    *new_count = last + 1;
+    return DSA_SUCCESS;
+}
@@ -0,0 +1,333 @@
+#include "dsa/vector/vector.h"
+
+#include <stdalign.h>
+#include <stdint.h>
+#include <string.h>
+
+#define _VECTOR_MIN_CAPACITY 8
+
+struct vector
+{
+    unsigned char* data;
+    // Start of the allocation; differs from `data` only for over-aligned buffers.
+    void* allocation;
+    size_t size;
+    size_t capacity;
+    size_t elem_size;
+    size_t alignment;
+    vector_destroy_element_func destroy_func;
+    dsa_allocator_t allocator;
+};
+
+static bool _is_over_aligned(const struct vector* vector)
+{
+    return vector->alignment > alignof(max_align_t);
+}
+
+static size_t _padding(const struct vector* vector)
+{
+    return _is_over_aligned(vector) ? vector->alignment - 1 : 0;
+}
+
+static size_t _allocation_bytes(const struct vector* vector)
+{
+    return vector->capacity * vector->elem_size + _padding(vector);
+}
+
+static unsigned char* _element(const struct vector* vector, const size_t index)
+{
+    return vector->data + index * vector->elem_size;
+}
+
+static dsa_error_code_t _reallocate(struct vector* vector, const size_t capacity)
+{
+    if (capacity == 0)
+    {
+        dsa_deallocate(&vector->allocator, vector->allocation, _allocation_bytes(vector));
+        vector->allocation = NULL;
+        vector->data = NULL;
+        vector->capacity = 0;
+        return DSA_SUCCESS;
+    }
+
+    const size_t padding = _padding(vector);
+    if (capacity > (SIZE_MAX - padding) / vector->elem_size)
+    {
+        return DSA_ALLOC_FAILURE;
+    }
+
+    const size_t bytes = capacity * vector->elem_size;
+
+    if (!_is_over_aligned(vector))
+    {
+        void* allocation = dsa_reallocate(&vector->allocator, vector->allocation, _allocation_bytes(vector), bytes);
+        if (!allocation)
+        {
+            return DSA_ALLOC_FAILURE;
+        }
+
+        vector->allocation = allocation;
+        vector->data = allocation;
+        vector->capacity = capacity;
+        return DSA_SUCCESS;
+    }
+
+    // Reallocation does not preserve alignment, so over-aligned buffers are moved manually.
+    void* allocation = dsa_allocate(&vector->allocator, bytes + padding);
+    if (!allocation)
+    {
+        return DSA_ALLOC_FAILURE;
+    }
+
+    const uintptr_t address = (uintptr_t)allocation;
+    unsigned char* data = (unsigned char*)allocation + ((vector->alignment - address % vector->alignment) % vector->alignment);
+
+    if (vector->size > 0)
+    {
+        memcpy(data, vector->data, vector->size * vector->elem_size);
+    }
+
+    dsa_deallocate(&vector->allocator, vector->allocation, _allocation_bytes(vector));
+    vector->allocation = allocation;
+    vector->data = data;
+    vector->capacity = capacity;
+
+    return DSA_SUCCESS;
+}
+
+static dsa_error_code_t _grow(struct vector* vector, const size_t required)
+{
+    if (required <= vector->capacity)
+    {
+        return DSA_SUCCESS;
+    }
+
+    size_t capacity = vector->capacity < _VECTOR_MIN_CAPACITY ? _VECTOR_MIN_CAPACITY : vector->capacity;
+    while (capacity < required)
+    {
+        capacity = capacity > SIZE_MAX / 3 * 2 ? required : capacity + capacity / 2;
+    }
+
+    return _reallocate(vector, capacity);
+}
+
+static void _destroy_range(struct vector* vector, const size_t begin, const size_t end)
+{
+    if (!vector->destroy_func)
+    {
+        return;
+    }
+
+    for (size_t i = begin; i < end; i++)
+    {
+        vector->destroy_func(_element(vector, i));
+    }
+}
+
+dsa_error_code_t dsa_vector_create(vector_t* handle, const size_t elem_size, const size_t alignment, vector_destroy_element_func func)
+{
+    return dsa_vector_create_with_allocator(handle, elem_size, alignment, func, NULL);
+}
+
+dsa_error_code_t dsa_vector_create_with_allocator(vector_t* handle, const size_t elem_size, const size_t alignment,
+                                                  vector_destroy_element_func func, const dsa_allocator_t* allocator)
+{
+    if (!handle || elem_size == 0 || (alignment & (alignment - 1)) != 0 ||
+        (allocator && (!allocator->allocate || !allocator->deallocate)))
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    const dsa_allocator_t resolved = allocator ? *allocator : *dsa_allocator_get_default();
+
+    *handle = dsa_allocate(&resolved, sizeof(**handle));
+
+    if (!(*handle))
+    {
+        return DSA_ALLOC_FAILURE;
+    }
+
+    (*handle)->data = NULL;
+    (*handle)->allocation = NULL;
+    (*handle)->size = 0;
+    (*handle)->capacity = 0;
+    (*handle)->elem_size = elem_size;
+    (*handle)->alignment = alignment;
+    (*handle)->destroy_func = func;
+    (*handle)->allocator = resolved;
+
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_vector_data(vector_t handle, void** data)
+{
+    if (!handle || !data)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    *data = handle->data;
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_vector_get_at(vector_t handle, const size_t index, void** elem)
+{
+    if (!handle || !elem || index >= handle->size)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    *elem = _element(handle, index);
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_vector_get_size(const vector_t handle, size_t* size)
+{
+    if (!handle || !size)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    *size = handle->size;
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_vector_get_capacity(const vector_t handle, size_t* capacity)
+{
+    if (!handle || !capacity)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    *capacity = handle->capacity;
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_vector_is_empty(vector_t handle, bool* is_empty)
+{
+    if (!handle || !is_empty)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    *is_empty = (handle->size == 0);
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_vector_reserve(vector_t handle, const size_t capacity)
+{
+    if (!handle)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    if (capacity <= handle->capacity)
+    {
+        return DSA_SUCCESS;
+    }
+
+    return _reallocate(handle, capacity);
+}
+
+dsa_error_code_t dsa_vector_shrink_to_fit(vector_t handle)
+{
+    if (!handle)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    if (handle->size == handle->capacity)
+    {
+        return DSA_SUCCESS;
+    }
+
+    return _reallocate(handle, handle->size);
+}
+
+dsa_error_code_t dsa_vector_push_back(vector_t handle, const void* elem)
+{
+    return dsa_vector_append(handle, elem, 1);
+}
+
+dsa_error_code_t dsa_vector_append(vector_t handle, const void* elems, const size_t count)
+{
+    if (!handle || !elems || count == 0 || count > SIZE_MAX - handle->size)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    const dsa_error_code_t result = _grow(handle, handle->size + count);
+    if (result != DSA_SUCCESS)
+    {
+        return result;
+    }
+
+    memcpy(_element(handle, handle->size), elems, count * handle->elem_size);
+    handle->size += count;
+
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_vector_pop_back(vector_t handle)
+{
+    if (!handle)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    if (handle->size == 0)
+    {
+        return DSA_EMPTY_LIST;
+    }
+
+    _destroy_range(handle, handle->size - 1, handle->size);
+    --handle->size;
+
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_vector_swap_remove(vector_t handle, const size_t index)
+{
+    if (!handle || index >= handle->size)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    _destroy_range(handle, index, index + 1);
+
+    const size_t last = handle->size - 1;
+    if (index != last)
+    {
+        memcpy(_element(handle, index), _element(handle, last), handle->elem_size);
+    }
+
+    --handle->size;
+    return DSA_SUCCESS;
+}
+
+dsa_error_code_t dsa_vector_clear(vector_t handle)
+{
+    if (!handle)
+    {
+        return DSA_INVALID_INPUT;
+    }
+
+    _destroy_range(handle, 0, handle->size);
+    handle->size = 0;
+
+    return DSA_SUCCESS;
+}
+
+void dsa_vector_destroy(vector_t handle)
+{
+    if (!handle)
+    {
+        return;
+    }
+
+    _destroy_range(handle, 0, handle->size);
+
+    const dsa_allocator_t allocator = handle->allocator;
+    dsa_deallocate(&allocator, handle->allocation, _allocation_bytes(handle));
+    dsa_deallocate(&allocator, handle, sizeof(*handle));
+}
@@ -0,0 +1,106 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "dsa/common/allocator.h"
+
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+
+struct counting_ctx
+{
+    size_t allocations = 0;
+    size_t deallocations = 0;
+    size_t live_bytes = 0;
+};
+
+void* counting_allocate(void* ctx, size_t size)
+{
+    auto* counts = static_cast<counting_ctx*>(ctx);
+    ++counts->allocations;
+    counts->live_bytes += size;
+    return std::malloc(size);
+}
+
+void counting_deallocate(void* ctx, void* ptr, size_t size)
+{
+    auto* counts = static_cast<counting_ctx*>(ctx);
+    ++counts->deallocations;
+    counts->live_bytes -= size;
+    std::free(ptr);
+}
+
+} // namespace
+
+TEST_CASE("Default allocator can be replaced and restored", "[allocator]")
+{
+    counting_ctx counts;
+    const dsa_allocator_t counting{counting_allocate, nullptr, counting_deallocate, &counts};
+
+    REQUIRE(dsa_allocator_get_default() == dsa_allocator_system());
+
+    REQUIRE(dsa_allocator_set_default(&counting) == DSA_SUCCESS);
+    REQUIRE(dsa_allocator_get_default() == &counting);
+
+    void* block = dsa_allocate(nullptr, 24);
+    REQUIRE(block != nullptr);
+    REQUIRE(counts.allocations == 1);
+    REQUIRE(counts.live_bytes == 24);
+
+    dsa_deallocate(nullptr, block, 24);
+    REQUIRE(counts.deallocations == 1);
+    REQUIRE(counts.live_bytes == 0);
+
+    REQUIRE(dsa_allocator_set_default(nullptr) == DSA_SUCCESS);
+    REQUIRE(dsa_allocator_get_default() == dsa_allocator_system());
+}
+
+TEST_CASE("dsa_allocator_set_default rejects incomplete allocators", "[allocator]")
+{
+    const dsa_allocator_t no_allocate{nullptr, nullptr, counting_deallocate, nullptr};
+    const dsa_allocator_t no_deallocate{counting_allocate, nullptr, nullptr, nullptr};
+
+    REQUIRE(dsa_allocator_set_default(&no_allocate) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_allocator_set_default(&no_deallocate) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_allocator_get_default() == dsa_allocator_system());
+}
+
+TEST_CASE("dsa_reallocate moves blocks without a reallocate callback", "[allocator]")
+{
+    counting_ctx counts;
+    const dsa_allocator_t counting{counting_allocate, nullptr, counting_deallocate, &counts};
+
+    auto* block = static_cast<char*>(dsa_reallocate(&counting, nullptr, 0, 4));
+    REQUIRE(block != nullptr);
+    std::memcpy(block, "abc", 4);
+
+    block = static_cast<char*>(dsa_reallocate(&counting, block, 4, 64));
+    REQUIRE(block != nullptr);
+    REQUIRE(std::strcmp(block, "abc") == 0);
+    REQUIRE(counts.allocations == 2);
+    REQUIRE(counts.deallocations == 1);
+    REQUIRE(counts.live_bytes == 64);
+
+    dsa_deallocate(&counting, block, 64);
+    REQUIRE(counts.live_bytes == 0);
+
+    REQUIRE(dsa_allocate(&counting, 0) == nullptr);
+    REQUIRE(counts.allocations == 2);
+    dsa_deallocate(&counting, nullptr, 0);
+    REQUIRE(counts.deallocations == 2);
+}
+
+TEST_CASE("dsa_allocator_equals compares callbacks and context", "[allocator]")
+{
+    counting_ctx first_counts;
+    counting_ctx second_counts;
+    const dsa_allocator_t first{counting_allocate, nullptr, counting_deallocate, &first_counts};
+    const dsa_allocator_t same{counting_allocate, nullptr, counting_deallocate, &first_counts};
+    const dsa_allocator_t second{counting_allocate, nullptr, counting_deallocate, &second_counts};
+
+    REQUIRE(dsa_allocator_equals(&first, &same));
+    REQUIRE_FALSE(dsa_allocator_equals(&first, &second));
+    REQUIRE(dsa_allocator_equals(nullptr, dsa_allocator_system()));
+    REQUIRE_FALSE(dsa_allocator_equals(nullptr, &first));
+}
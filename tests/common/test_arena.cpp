@@ -0,0 +1,186 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "dsa/common/arena.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+dsa_arena_t make_arena(const size_t chunk_size, const bool huge_pages = false)
+{
+    dsa_arena_options_t options{};
+    options.chunk_size = chunk_size;
+    options.huge_pages = huge_pages;
+
+    dsa_arena_t arena = nullptr;
+    REQUIRE(dsa_arena_create(&arena, &options) == DSA_SUCCESS);
+    return arena;
+}
+
+void* alloc(dsa_arena_t arena, const size_t size, const size_t alignment = 0)
+{
+    void* ptr = nullptr;
+    REQUIRE(dsa_arena_alloc(arena, size, alignment, &ptr) == DSA_SUCCESS);
+    REQUIRE(ptr != nullptr);
+    return ptr;
+}
+
+} // namespace
+
+TEST_CASE("Arena handles invalid input", "[arena]")
+{
+    dsa_arena_t arena = make_arena(0);
+    void* ptr = nullptr;
+    dsa_arena_mark_t mark;
+    dsa_allocator_t allocator;
+    size_t capacity = 0;
+
+    REQUIRE(dsa_arena_create(nullptr, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_arena_alloc(nullptr, 8, 0, &ptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_arena_alloc(arena, 0, 0, &ptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_arena_alloc(arena, 8, 3, &ptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_arena_alloc(arena, 8, 0, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_arena_mark(nullptr, &mark) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_arena_mark(arena, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_arena_rewind(nullptr, &mark) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_arena_rewind(arena, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_arena_reset(nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_arena_get_capacity(nullptr, &capacity) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_arena_get_capacity(arena, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_arena_get_allocator(nullptr, &allocator) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_arena_get_allocator(arena, nullptr) == DSA_INVALID_INPUT);
+
+    dsa_arena_destroy(arena);
+    dsa_arena_destroy(nullptr);
+}
+
+TEST_CASE("Arena returns aligned, non-overlapping blocks", "[arena]")
+{
+    const bool huge_pages = GENERATE(false, true);
+    dsa_arena_t arena = make_arena(1024, huge_pages);
+
+    std::vector<std::pair<unsigned char*, size_t>> blocks;
+    for (size_t i = 0; i < 200; i++)
+    {
+        const size_t alignment = size_t{1} << (i % 8);
+        const size_t size = 1 + i % 37;
+        auto* block = static_cast<unsigned char*>(alloc(arena, size, alignment));
+
+        REQUIRE(reinterpret_cast<uintptr_t>(block) % alignment == 0);
+        std::memset(block, static_cast<int>(i), size);
+        blocks.emplace_back(block, size);
+    }
+
+    // Overlapping blocks would have overwritten each other's fill byte.
+    for (size_t i = 0; i < blocks.size(); i++)
+    {
+        for (size_t j = 0; j < blocks[i].second; j++)
+        {
+            REQUIRE(blocks[i].first[j] == static_cast<unsigned char>(i));
+        }
+    }
+
+    SECTION("Default alignment suits any fundamental type")
+    {
+        REQUIRE(reinterpret_cast<uintptr_t>(alloc(arena, 1)) % alignof(std::max_align_t) == 0);
+    }
+
+    SECTION("Blocks larger than a chunk get a chunk of their own")
+    {
+        auto* block = static_cast<unsigned char*>(alloc(arena, 10000, 64));
+        std::memset(block, 0, 10000);
+        REQUIRE(reinterpret_cast<uintptr_t>(block) % 64 == 0);
+    }
+
+    dsa_arena_destroy(arena);
+}
+
+TEST_CASE("Arena rewinds to a mark and resets in place", "[arena]")
+{
+    dsa_arena_t arena = make_arena(256);
+
+    dsa_arena_mark_t empty;
+    REQUIRE(dsa_arena_mark(arena, &empty) == DSA_SUCCESS);
+
+    void* first = alloc(arena, 32);
+
+    dsa_arena_mark_t mark;
+    REQUIRE(dsa_arena_mark(arena, &mark) == DSA_SUCCESS);
+
+    void* second = alloc(arena, 48);
+    for (int i = 0; i < 20; i++)
+    {
+        alloc(arena, 100);
+    }
+
+    size_t capacity = 0;
+    REQUIRE(dsa_arena_get_capacity(arena, &capacity) == DSA_SUCCESS);
+    REQUIRE(capacity >= 2000);
+
+    SECTION("Rewind reuses the memory after the mark")
+    {
+        REQUIRE(dsa_arena_rewind(arena, &mark) == DSA_SUCCESS);
+        REQUIRE(alloc(arena, 48) == second);
+    }
+
+    SECTION("Reset reuses all chunks")
+    {
+        REQUIRE(dsa_arena_reset(arena) == DSA_SUCCESS);
+        REQUIRE(alloc(arena, 32) == first);
+        for (int i = 0; i < 20; i++)
+        {
+            alloc(arena, 100);
+        }
+
+        size_t after_reset = 0;
+        REQUIRE(dsa_arena_get_capacity(arena, &after_reset) == DSA_SUCCESS);
+        REQUIRE(after_reset == capacity);
+    }
+
+    SECTION("Rewind to a mark taken before the first allocation")
+    {
+        REQUIRE(dsa_arena_rewind(arena, &empty) == DSA_SUCCESS);
+        REQUIRE(alloc(arena, 32) == first);
+    }
+
+    dsa_arena_destroy(arena);
+}
+
+TEST_CASE("Arena allocator adapter", "[arena]")
+{
+    dsa_arena_t arena = make_arena(256);
+    dsa_allocator_t allocator;
+    REQUIRE(dsa_arena_get_allocator(arena, &allocator) == DSA_SUCCESS);
+
+    auto* block = static_cast<char*>(dsa_allocate(&allocator, 16));
+    REQUIRE(block != nullptr);
+    std::memcpy(block, "arena", 6);
+
+    SECTION("The most recent block grows in place")
+    {
+        REQUIRE(dsa_reallocate(&allocator, block, 16, 64) == block);
+    }
+
+    SECTION("Older blocks are moved when they grow")
+    {
+        void* other = dsa_allocate(&allocator, 8);
+        auto* moved = static_cast<char*>(dsa_reallocate(&allocator, block, 16, 64));
+        REQUIRE(moved != block);
+        REQUIRE(moved != other);
+        REQUIRE(std::strcmp(moved, "arena") == 0);
+    }
+
+    SECTION("Deallocating the most recent block reclaims it")
+    {
+        dsa_deallocate(&allocator, block, 16);
+        REQUIRE(dsa_allocate(&allocator, 16) == block);
+    }
+
+    dsa_arena_destroy(arena);
+}
@@ -0,0 +1,58 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "dsa/common/cpu.h"
+
+#include <string_view>
+
+TEST_CASE("dsa_cpu_detect returns a stable level", "[cpu]")
+{
+    const dsa_cpu_level_t detected = dsa_cpu_detect();
+
+    REQUIRE(detected >= DSA_CPU_LEVEL_SCALAR);
+    REQUIRE(detected <= DSA_CPU_LEVEL_AVX512);
+    REQUIRE(dsa_cpu_detect() == detected);
+
+#if defined(__x86_64__) || defined(_M_X64)
+    REQUIRE(detected >= DSA_CPU_LEVEL_SSE2);
+#endif
+}
+
+TEST_CASE("dsa_cpu_force_level lowers the dispatch level", "[cpu]")
+{
+    const dsa_cpu_level_t detected = dsa_cpu_detect();
+
+    SECTION("Every supported level can be forced")
+    {
+        for (int level = DSA_CPU_LEVEL_SCALAR; level <= detected; level++)
+        {
+            REQUIRE(dsa_cpu_force_level(static_cast<dsa_cpu_level_t>(level)) == DSA_SUCCESS);
+            REQUIRE(dsa_cpu_get_level() == level);
+        }
+    }
+
+    SECTION("Levels above the detected one are rejected")
+    {
+        REQUIRE(dsa_cpu_force_level(DSA_CPU_LEVEL_SCALAR) == DSA_SUCCESS);
+
+        if (detected < DSA_CPU_LEVEL_AVX512)
+        {
+            REQUIRE(dsa_cpu_force_level(static_cast<dsa_cpu_level_t>(detected + 1)) == DSA_INVALID_INPUT);
+        }
+        REQUIRE(dsa_cpu_force_level(static_cast<dsa_cpu_level_t>(-1)) == DSA_INVALID_INPUT);
+        REQUIRE(dsa_cpu_force_level(static_cast<dsa_cpu_level_t>(DSA_CPU_LEVEL_AVX512 + 1)) == DSA_INVALID_INPUT);
+        REQUIRE(dsa_cpu_get_level() == DSA_CPU_LEVEL_SCALAR);
+    }
+
+    REQUIRE(dsa_cpu_force_level(detected) == DSA_SUCCESS);
+    REQUIRE(dsa_cpu_get_level() == detected);
+}
+
+TEST_CASE("dsa_cpu_level_name names every level", "[cpu]")
+{
+    REQUIRE(std::string_view(dsa_cpu_level_name(DSA_CPU_LEVEL_SCALAR)) == "scalar");
+    REQUIRE(std::string_view(dsa_cpu_level_name(DSA_CPU_LEVEL_SSE2)) == "sse2");
+    REQUIRE(std::string_view(dsa_cpu_level_name(DSA_CPU_LEVEL_SSE4_2)) == "sse4.2");
+    REQUIRE(std::string_view(dsa_cpu_level_name(DSA_CPU_LEVEL_AVX2)) == "avx2");
+    REQUIRE(std::string_view(dsa_cpu_level_name(DSA_CPU_LEVEL_AVX512)) == "avx512");
+    REQUIRE(std::string_view(dsa_cpu_level_name(static_cast<dsa_cpu_level_t>(42))) == "unknown");
+}
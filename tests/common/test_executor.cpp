@@ -0,0 +1,243 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "dsa/common/executor.h"
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+void count_task(void* arg)
+{
+    static_cast<std::atomic<int>*>(arg)->fetch_add(1);
+}
+
+struct order_record
+{
+    std::vector<int> order;
+    int next = 0;
+};
+
+void record_order(void* arg)
+{
+    auto* record = static_cast<order_record*>(arg);
+    record->order.push_back(record->next++);
+}
+
+struct fib_task
+{
+    dsa_executor_t executor;
+    int n;
+    long long result;
+};
+
+// Every call forks one half into a nested task group and computes the other itself.
+void fib(void* arg)
+{
+    auto* task = static_cast<fib_task*>(arg);
+    if (task->n < 2)
+    {
+        task->result = task->n;
+        return;
+    }
+
+    fib_task left{task->executor, task->n - 1, 0};
+    fib_task right{task->executor, task->n - 2, 0};
+
+    dsa_task_group_t group;
+    dsa_task_group_init(&group, task->executor);
+    dsa_task_group_run(&group, fib, &left);
+    fib(&right);
+    dsa_task_group_wait(&group);
+
+    task->result = left.result + right.result;
+}
+
+void mark_range(size_t begin, size_t end, void* ctx)
+{
+    auto* hits = static_cast<std::vector<std::atomic<int>>*>(ctx);
+    for (size_t i = begin; i < end; i++)
+    {
+        (*hits)[i].fetch_add(1);
+    }
+}
+
+void record_range(size_t begin, size_t end, void* ctx)
+{
+    static_cast<std::vector<std::pair<size_t, size_t>>*>(ctx)->emplace_back(begin, end);
+}
+
+dsa_executor_t make_executor(const size_t num_threads, const bool pin_threads = false)
+{
+    dsa_executor_options_t options{};
+    options.num_threads = num_threads;
+    options.pin_threads = pin_threads;
+
+    dsa_executor_t executor = nullptr;
+    REQUIRE(dsa_executor_create(&executor, &options) == DSA_SUCCESS);
+    return executor;
+}
+
+dsa_executor_t make_caller_executor()
+{
+    dsa_executor_options_t options{};
+    options.run_on_caller = true;
+
+    dsa_executor_t executor = nullptr;
+    REQUIRE(dsa_executor_create(&executor, &options) == DSA_SUCCESS);
+    return executor;
+}
+
+} // namespace
+
+TEST_CASE("Executor handles invalid input", "[executor]")
+{
+    dsa_executor_t executor = make_executor(1);
+    dsa_task_group_t group;
+    size_t num_threads = 0;
+
+    REQUIRE(dsa_executor_create(nullptr, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_executor_get_default(nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_executor_get_thread_count(nullptr, &num_threads) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_executor_get_thread_count(executor, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_executor_parallel_for(executor, 0, 1, mark_range, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_executor_parallel_for(executor, 10, 1, nullptr, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_task_group_init(nullptr, executor) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_task_group_init(&group, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_task_group_init(&group, executor) == DSA_SUCCESS);
+    REQUIRE(dsa_task_group_run(nullptr, count_task, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_task_group_run(&group, nullptr, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_task_group_wait(nullptr) == DSA_INVALID_INPUT);
+
+    dsa_executor_destroy(executor);
+    dsa_executor_destroy(nullptr);
+}
+
+TEST_CASE("Executor reports its thread count", "[executor]")
+{
+    size_t num_threads = 0;
+
+    SECTION("Explicit thread count")
+    {
+        dsa_executor_t executor = make_executor(3);
+        REQUIRE(dsa_executor_get_thread_count(executor, &num_threads) == DSA_SUCCESS);
+        REQUIRE(num_threads == 3);
+        dsa_executor_destroy(executor);
+    }
+
+    SECTION("Run on caller mode has no threads")
+    {
+        dsa_executor_t executor = make_caller_executor();
+        REQUIRE(dsa_executor_get_thread_count(executor, &num_threads) == DSA_SUCCESS);
+        REQUIRE(num_threads == 0);
+        dsa_executor_destroy(executor);
+    }
+
+    SECTION("Default executor is shared")
+    {
+        dsa_executor_t first = nullptr;
+        dsa_executor_t second = nullptr;
+        REQUIRE(dsa_executor_get_default(&first) == DSA_SUCCESS);
+        REQUIRE(dsa_executor_get_default(&second) == DSA_SUCCESS);
+        REQUIRE(first == second);
+        REQUIRE(dsa_executor_get_thread_count(first, &num_threads) == DSA_SUCCESS);
+        REQUIRE(num_threads >= 1);
+    }
+}
+
+TEST_CASE("Task group waits for all of its tasks", "[executor]")
+{
+    const bool pin_threads = GENERATE(false, true);
+    dsa_executor_t executor = make_executor(4, pin_threads);
+    std::atomic<int> counter{0};
+
+    dsa_task_group_t group;
+    REQUIRE(dsa_task_group_init(&group, executor) == DSA_SUCCESS);
+
+    for (int i = 0; i < 1000; i++)
+    {
+        REQUIRE(dsa_task_group_run(&group, count_task, &counter) == DSA_SUCCESS);
+    }
+    REQUIRE(dsa_task_group_wait(&group) == DSA_SUCCESS);
+    REQUIRE(counter.load() == 1000);
+
+    SECTION("Group can be reused after waiting")
+    {
+        REQUIRE(dsa_task_group_run(&group, count_task, &counter) == DSA_SUCCESS);
+        REQUIRE(dsa_task_group_wait(&group) == DSA_SUCCESS);
+        REQUIRE(counter.load() == 1001);
+    }
+
+    dsa_executor_destroy(executor);
+}
+
+TEST_CASE("Task groups can be nested", "[executor]")
+{
+    const bool run_on_caller = GENERATE(false, true);
+    dsa_executor_t executor = run_on_caller ? make_caller_executor() : make_executor(3);
+
+    fib_task task{executor, 18, 0};
+    fib(&task);
+    REQUIRE(task.result == 2584);
+
+    dsa_executor_destroy(executor);
+}
+
+TEST_CASE("Run on caller mode runs tasks in spawn order", "[executor]")
+{
+    dsa_executor_t executor = make_caller_executor();
+    order_record record;
+
+    dsa_task_group_t group;
+    REQUIRE(dsa_task_group_init(&group, executor) == DSA_SUCCESS);
+
+    for (int i = 0; i < 5; i++)
+    {
+        REQUIRE(dsa_task_group_run(&group, record_order, &record) == DSA_SUCCESS);
+        REQUIRE(record.order.size() == static_cast<size_t>(i + 1));
+    }
+    REQUIRE(dsa_task_group_wait(&group) == DSA_SUCCESS);
+    REQUIRE(record.order == std::vector<int>{0, 1, 2, 3, 4});
+
+    dsa_executor_destroy(executor);
+}
+
+TEST_CASE("dsa_executor_parallel_for visits every index once", "[executor]")
+{
+    const size_t count = GENERATE(size_t{1}, size_t{7}, size_t{1000}, size_t{100003});
+    const size_t grain = GENERATE(size_t{0}, size_t{1}, size_t{64});
+
+    std::vector<std::atomic<int>> hits(count);
+
+    SECTION("Worker threads")
+    {
+        dsa_executor_t executor = make_executor(4);
+        REQUIRE(dsa_executor_parallel_for(executor, count, grain, mark_range, &hits) == DSA_SUCCESS);
+        dsa_executor_destroy(executor);
+    }
+
+    SECTION("Default executor")
+    {
+        REQUIRE(dsa_executor_parallel_for(nullptr, count, grain, mark_range, &hits) == DSA_SUCCESS);
+    }
+
+    for (const auto& hit : hits)
+    {
+        REQUIRE(hit.load() == 1);
+    }
+}
+
+TEST_CASE("dsa_executor_parallel_for runs on caller in ascending order", "[executor]")
+{
+    dsa_executor_t executor = make_caller_executor();
+    std::vector<std::pair<size_t, size_t>> ranges;
+
+    REQUIRE(dsa_executor_parallel_for(executor, 10, 4, record_range, &ranges) == DSA_SUCCESS);
+    REQUIRE(ranges == std::vector<std::pair<size_t, size_t>>{{0, 4}, {4, 8}, {8, 10}});
+
+    dsa_executor_destroy(executor);
+}
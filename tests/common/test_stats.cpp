@@ -0,0 +1,69 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "dsa/common/allocator.h"
+#include "dsa/common/stats.h"
+
+#include <thread>
+
+TEST_CASE("dsa_stats_snapshot validates its argument", "[stats]")
+{
+    REQUIRE(dsa_stats_snapshot(nullptr) == DSA_INVALID_INPUT);
+}
+
+TEST_CASE("Allocator calls are counted on the calling thread", "[stats]")
+{
+    // The counters only advance when the library is built with DSA_ENABLE_STATS.
+    const uint64_t scale = dsa_stats_enabled() ? 1 : 0;
+    dsa_stats_t stats{};
+
+    dsa_stats_reset();
+    REQUIRE(dsa_stats_snapshot(&stats) == DSA_SUCCESS);
+    REQUIRE(stats.comparisons == 0);
+    REQUIRE(stats.moves == 0);
+    REQUIRE(stats.allocations == 0);
+    REQUIRE(stats.allocated_bytes == 0);
+    REQUIRE(stats.deallocations == 0);
+
+    SECTION("Allocate, reallocate and deallocate")
+    {
+        void* block = dsa_allocate(nullptr, 32);
+        REQUIRE(block != nullptr);
+        block = dsa_reallocate(nullptr, block, 32, 96);
+        REQUIRE(block != nullptr);
+        dsa_deallocate(nullptr, block, 96);
+
+        REQUIRE(dsa_stats_snapshot(&stats) == DSA_SUCCESS);
+        REQUIRE(stats.allocations == 2 * scale);
+        REQUIRE(stats.allocated_bytes == 128 * scale);
+        REQUIRE(stats.deallocations == 1 * scale);
+
+        dsa_stats_reset();
+        REQUIRE(dsa_stats_snapshot(&stats) == DSA_SUCCESS);
+        REQUIRE(stats.allocations == 0);
+        REQUIRE(stats.deallocations == 0);
+    }
+
+    SECTION("Zero-sized requests and NULL blocks are not counted")
+    {
+        REQUIRE(dsa_allocate(nullptr, 0) == nullptr);
+        dsa_deallocate(nullptr, nullptr, 16);
+
+        REQUIRE(dsa_stats_snapshot(&stats) == DSA_SUCCESS);
+        REQUIRE(stats.allocations == 0);
+        REQUIRE(stats.deallocations == 0);
+    }
+
+    SECTION("Work on other threads does not show up")
+    {
+        dsa_stats_t worker_stats{};
+        std::thread worker([&] {
+            dsa_deallocate(nullptr, dsa_allocate(nullptr, 8), 8);
+            dsa_stats_snapshot(&worker_stats);
+        });
+        worker.join();
+
+        REQUIRE(worker_stats.allocations == 1 * scale);
+        REQUIRE(dsa_stats_snapshot(&stats) == DSA_SUCCESS);
+        REQUIRE(stats.allocations == 0);
+    }
+}
@@ -0,0 +1,40 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "dsa/common/trace.h"
+
+#include <string_view>
+#include <vector>
+
+namespace
+{
+void record_event(const dsa_trace_event_t* event, void* ctx)
+{
+    static_cast<std::vector<dsa_trace_event_t>*>(ctx)->push_back(*event);
+}
+}
+
+TEST_CASE("Emitted trace points reach the installed hook", "[trace]")
+{
+    std::vector<dsa_trace_event_t> events;
+    REQUIRE(dsa_trace_set_hook(record_event, &events) == DSA_SUCCESS);
+
+    dsa_trace_emit("probe", DSA_TRACE_PHASE_ENTRY, 10, 4);
+    dsa_trace_emit("probe", DSA_TRACE_PHASE_EXIT, 11, 4);
+
+    REQUIRE(events.size() == 2);
+    REQUIRE(std::string_view{events[0].probe} == "probe");
+    REQUIRE(events[0].phase == DSA_TRACE_PHASE_ENTRY);
+    REQUIRE(events[0].size == 10);
+    REQUIRE(events[0].elem_size == 4);
+    REQUIRE(events[1].phase == DSA_TRACE_PHASE_EXIT);
+    REQUIRE(events[1].size == 11);
+
+    SECTION("Removing the hook stops the calls")
+    {
+        REQUIRE(dsa_trace_set_hook(nullptr, nullptr) == DSA_SUCCESS);
+        dsa_trace_emit("probe", DSA_TRACE_PHASE_ENTRY, 1, 1);
+        REQUIRE(events.size() == 2);
+    }
+
+    REQUIRE(dsa_trace_set_hook(nullptr, nullptr) == DSA_SUCCESS);
+}
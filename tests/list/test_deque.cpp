@@ -0,0 +1,211 @@
+#include "dsa/list/deque.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdlib>
+#include <deque>
+#include <vector>
+
+namespace
+{
+void count_destroyed(void* data)
+{
+    ++*static_cast<int*>(data);
+}
+
+std::vector<int> values_of(deque_t deque)
+{
+    size_t size = 0;
+    REQUIRE(dsa_deque_get_size(deque, &size) == DSA_SUCCESS);
+
+    std::vector<int> values;
+    for (size_t i = 0; i < size; i++)
+    {
+        void* data = nullptr;
+        REQUIRE(dsa_deque_get_at(deque, i, &data) == DSA_SUCCESS);
+        values.push_back(*static_cast<int*>(data));
+    }
+    return values;
+}
+
+struct counting_ctx
+{
+    size_t allocations = 0;
+    size_t live_bytes = 0;
+};
+
+void* counting_allocate(void* ctx, size_t size)
+{
+    auto* counts = static_cast<counting_ctx*>(ctx);
+    ++counts->allocations;
+    counts->live_bytes += size;
+    return std::malloc(size);
+}
+
+void counting_deallocate(void* ctx, void* ptr, size_t size)
+{
+    static_cast<counting_ctx*>(ctx)->live_bytes -= size;
+    std::free(ptr);
+}
+} // namespace
+
+TEST_CASE("Create and destroy deque", "[deque]")
+{
+    deque_t deque = nullptr;
+    REQUIRE(dsa_deque_create(nullptr, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_deque_create(&deque, nullptr) == DSA_SUCCESS);
+    REQUIRE(deque != nullptr);
+
+    bool empty = false;
+    void* head = &empty;
+    void* tail = &empty;
+    REQUIRE(dsa_deque_is_empty(deque, &empty) == DSA_SUCCESS);
+    REQUIRE(dsa_deque_get_head(deque, &head) == DSA_SUCCESS);
+    REQUIRE(dsa_deque_get_tail(deque, &tail) == DSA_SUCCESS);
+    REQUIRE(empty);
+    REQUIRE(head == nullptr);
+    REQUIRE(tail == nullptr);
+
+    dsa_deque_destroy(deque);
+    dsa_deque_destroy(nullptr);
+}
+
+TEST_CASE("Deque handles invalid input", "[deque][error]")
+{
+    deque_t deque = nullptr;
+    REQUIRE(dsa_deque_create(&deque, nullptr) == DSA_SUCCESS);
+
+    int value = 1;
+    void* data = nullptr;
+    REQUIRE(dsa_deque_push_front(deque, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_deque_push_back(nullptr, &value) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_deque_pop_front(deque) == DSA_EMPTY_LIST);
+    REQUIRE(dsa_deque_pop_back(deque) == DSA_EMPTY_LIST);
+    REQUIRE(dsa_deque_get_at(deque, 0, &data) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_deque_get_size(deque, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_deque_reserve(nullptr, 4) == DSA_INVALID_INPUT);
+
+    dsa_deque_destroy(deque);
+}
+
+TEST_CASE("Push and pop at both ends", "[deque]")
+{
+    deque_t deque = nullptr;
+    REQUIRE(dsa_deque_create(&deque, nullptr) == DSA_SUCCESS);
+
+    int values[] = {0, 1, 2, 3};
+    REQUIRE(dsa_deque_push_back(deque, &values[2]) == DSA_SUCCESS);
+    REQUIRE(dsa_deque_push_front(deque, &values[1]) == DSA_SUCCESS);
+    REQUIRE(dsa_deque_push_back(deque, &values[3]) == DSA_SUCCESS);
+    REQUIRE(dsa_deque_push_front(deque, &values[0]) == DSA_SUCCESS);
+    REQUIRE(values_of(deque) == std::vector<int>{0, 1, 2, 3});
+
+    void* head = nullptr;
+    void* tail = nullptr;
+    REQUIRE(dsa_deque_get_head(deque, &head) == DSA_SUCCESS);
+    REQUIRE(dsa_deque_get_tail(deque, &tail) == DSA_SUCCESS);
+    REQUIRE(head == &values[0]);
+    REQUIRE(tail == &values[3]);
+
+    REQUIRE(dsa_deque_pop_front(deque) == DSA_SUCCESS);
+    REQUIRE(dsa_deque_pop_back(deque) == DSA_SUCCESS);
+    REQUIRE(values_of(deque) == std::vector<int>{1, 2});
+
+    dsa_deque_destroy(deque);
+}
+
+TEST_CASE("Deque grows while wrapped around", "[deque]")
+{
+    deque_t deque = nullptr;
+    REQUIRE(dsa_deque_create(&deque, nullptr) == DSA_SUCCESS);
+
+    std::vector<int> values(1000);
+    std::deque<int> expected;
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        values[i] = static_cast<int>(i);
+        if (i % 3 == 0)
+        {
+            REQUIRE(dsa_deque_push_front(deque, &values[i]) == DSA_SUCCESS);
+            expected.push_front(values[i]);
+        }
+        else
+        {
+            REQUIRE(dsa_deque_push_back(deque, &values[i]) == DSA_SUCCESS);
+            expected.push_back(values[i]);
+        }
+
+        if (i % 7 == 0)
+        {
+            REQUIRE(dsa_deque_pop_front(deque) == DSA_SUCCESS);
+            expected.pop_front();
+        }
+    }
+
+    REQUIRE(values_of(deque) == std::vector<int>(expected.begin(), expected.end()));
+
+    dsa_deque_destroy(deque);
+}
+
+TEST_CASE("Reserve keeps elements in order", "[deque]")
+{
+    deque_t deque = nullptr;
+    REQUIRE(dsa_deque_create(&deque, nullptr) == DSA_SUCCESS);
+
+    int values[] = {0, 1, 2, 3, 4, 5, 6, 7};
+    for (int& value : values)
+    {
+        REQUIRE(dsa_deque_push_front(deque, &value) == DSA_SUCCESS);
+    }
+
+    REQUIRE(dsa_deque_reserve(deque, 100) == DSA_SUCCESS);
+    REQUIRE(dsa_deque_reserve(deque, 10) == DSA_SUCCESS);
+    REQUIRE(values_of(deque) == std::vector<int>{7, 6, 5, 4, 3, 2, 1, 0});
+
+    dsa_deque_destroy(deque);
+}
+
+TEST_CASE("Deque calls destroy callback", "[deque]")
+{
+    deque_t deque = nullptr;
+    REQUIRE(dsa_deque_create(&deque, count_destroyed) == DSA_SUCCESS);
+
+    int counters[] = {0, 0, 0, 0, 0};
+    for (int& counter : counters)
+    {
+        REQUIRE(dsa_deque_push_back(deque, &counter) == DSA_SUCCESS);
+    }
+
+    REQUIRE(dsa_deque_pop_front(deque) == DSA_SUCCESS);
+    REQUIRE(dsa_deque_pop_back(deque) == DSA_SUCCESS);
+    REQUIRE(counters[0] == 1);
+    REQUIRE(counters[4] == 1);
+
+    REQUIRE(dsa_deque_clear(deque) == DSA_SUCCESS);
+    REQUIRE(counters[1] == 1);
+    REQUIRE(counters[2] == 1);
+    REQUIRE(counters[3] == 1);
+
+    REQUIRE(dsa_deque_push_back(deque, &counters[0]) == DSA_SUCCESS);
+    dsa_deque_destroy(deque);
+    REQUIRE(counters[0] == 2);
+}
+
+TEST_CASE("Deque obtains all memory from its allocator", "[deque]")
+{
+    counting_ctx counts;
+    const dsa_allocator_t counting{counting_allocate, nullptr, counting_deallocate, &counts};
+
+    deque_t deque = nullptr;
+    REQUIRE(dsa_deque_create_with_allocator(&deque, nullptr, &counting) == DSA_SUCCESS);
+
+    std::vector<int> values(100);
+    for (int& value : values)
+    {
+        REQUIRE(dsa_deque_push_back(deque, &value) == DSA_SUCCESS);
+    }
+    REQUIRE(counts.allocations > 2);
+
+    dsa_deque_destroy(deque);
+    REQUIRE(counts.live_bytes == 0);
+}
@@ -0,0 +1,178 @@
+#include "dsa/list/islist.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <vector>
+
+namespace
+{
+struct Item
+{
+    int value;
+    islist_link_t link;
+};
+
+int value_of(islist_link_t* link)
+{
+    return DSA_CONTAINER_OF(link, Item, link)->value;
+}
+
+std::vector<int> values_of(const islist_t& list)
+{
+    std::vector<int> values;
+    islist_link_t* pos = nullptr;
+    DSA_ISLIST_FOR_EACH(pos, &list)
+    {
+        values.push_back(value_of(pos));
+    }
+    return values;
+}
+} // namespace
+
+TEST_CASE("Initialize intrusive list", "[islist]")
+{
+    islist_t list;
+    REQUIRE(dsa_islist_init(&list) == DSA_SUCCESS);
+
+    bool empty = false;
+    size_t size = 1;
+    REQUIRE(dsa_islist_is_empty(&list, &empty) == DSA_SUCCESS);
+    REQUIRE(dsa_islist_get_size(&list, &size) == DSA_SUCCESS);
+    REQUIRE(empty);
+    REQUIRE(size == 0);
+
+    islist_link_t* head = nullptr;
+    islist_link_t* tail = nullptr;
+    REQUIRE(dsa_islist_get_head(&list, &head) == DSA_SUCCESS);
+    REQUIRE(dsa_islist_get_tail(&list, &tail) == DSA_SUCCESS);
+    REQUIRE(head == nullptr);
+    REQUIRE(tail == nullptr);
+}
+
+TEST_CASE("Intrusive list handles invalid input", "[islist][error]")
+{
+    islist_t list;
+    REQUIRE(dsa_islist_init(&list) == DSA_SUCCESS);
+    Item item{1, {}};
+
+    REQUIRE(dsa_islist_init(nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_islist_push_front(&list, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_islist_push_back(nullptr, &item.link) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_islist_pop_front(nullptr, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_islist_splice(&list, &list) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_islist_reverse(nullptr) == DSA_INVALID_INPUT);
+}
+
+TEST_CASE("Push and pop links", "[islist]")
+{
+    std::array<Item, 3> items{{{1, {}}, {2, {}}, {3, {}}}};
+    islist_t list;
+    REQUIRE(dsa_islist_init(&list) == DSA_SUCCESS);
+
+    REQUIRE(dsa_islist_push_back(&list, &items[1].link) == DSA_SUCCESS);
+    REQUIRE(dsa_islist_push_front(&list, &items[0].link) == DSA_SUCCESS);
+    REQUIRE(dsa_islist_push_back(&list, &items[2].link) == DSA_SUCCESS);
+    REQUIRE(values_of(list) == std::vector<int>{1, 2, 3});
+
+    islist_link_t* link = nullptr;
+    REQUIRE(dsa_islist_pop_front(&list, &link) == DSA_SUCCESS);
+    REQUIRE(value_of(link) == 1);
+
+    REQUIRE(dsa_islist_pop_back(&list, &link) == DSA_SUCCESS);
+    REQUIRE(value_of(link) == 3);
+
+    REQUIRE(dsa_islist_pop_back(&list, &link) == DSA_SUCCESS);
+    REQUIRE(value_of(link) == 2);
+
+    REQUIRE(dsa_islist_pop_front(&list, &link) == DSA_EMPTY_LIST);
+    REQUIRE(dsa_islist_pop_back(&list, &link) == DSA_EMPTY_LIST);
+    REQUIRE(list.head == nullptr);
+    REQUIRE(list.tail == nullptr);
+}
+
+TEST_CASE("Splice intrusive lists", "[islist]")
+{
+    std::array<Item, 4> items{{{1, {}}, {2, {}}, {3, {}}, {4, {}}}};
+    islist_t first;
+    islist_t second;
+    REQUIRE(dsa_islist_init(&first) == DSA_SUCCESS);
+    REQUIRE(dsa_islist_init(&second) == DSA_SUCCESS);
+
+    SECTION("Splice into empty list")
+    {
+        REQUIRE(dsa_islist_push_back(&second, &items[0].link) == DSA_SUCCESS);
+        REQUIRE(dsa_islist_push_back(&second, &items[1].link) == DSA_SUCCESS);
+
+        REQUIRE(dsa_islist_splice(&first, &second) == DSA_SUCCESS);
+        REQUIRE(values_of(first) == std::vector<int>{1, 2});
+        REQUIRE(first.size == 2);
+        REQUIRE(second.size == 0);
+        REQUIRE(second.head == nullptr);
+    }
+
+    SECTION("Splice onto non-empty list")
+    {
+        REQUIRE(dsa_islist_push_back(&first, &items[0].link) == DSA_SUCCESS);
+        REQUIRE(dsa_islist_push_back(&first, &items[1].link) == DSA_SUCCESS);
+        REQUIRE(dsa_islist_push_back(&second, &items[2].link) == DSA_SUCCESS);
+        REQUIRE(dsa_islist_push_back(&second, &items[3].link) == DSA_SUCCESS);
+
+        REQUIRE(dsa_islist_splice(&first, &second) == DSA_SUCCESS);
+        REQUIRE(values_of(first) == std::vector<int>{1, 2, 3, 4});
+        REQUIRE(first.tail == &items[3].link);
+        REQUIRE(values_of(second).empty());
+    }
+
+    SECTION("Splice empty list is a no-op")
+    {
+        REQUIRE(dsa_islist_push_back(&first, &items[0].link) == DSA_SUCCESS);
+        REQUIRE(dsa_islist_splice(&first, &second) == DSA_SUCCESS);
+        REQUIRE(values_of(first) == std::vector<int>{1});
+    }
+}
+
+TEST_CASE("Reverse and clear intrusive list", "[islist]")
+{
+    std::array<Item, 3> items{{{1, {}}, {2, {}}, {3, {}}}};
+    islist_t list;
+    REQUIRE(dsa_islist_init(&list) == DSA_SUCCESS);
+
+    for (Item& item : items)
+    {
+        REQUIRE(dsa_islist_push_back(&list, &item.link) == DSA_SUCCESS);
+    }
+
+    REQUIRE(dsa_islist_reverse(&list) == DSA_SUCCESS);
+    REQUIRE(values_of(list) == std::vector<int>{3, 2, 1});
+    REQUIRE(value_of(list.tail) == 1);
+
+    REQUIRE(dsa_islist_clear(&list) == DSA_SUCCESS);
+    REQUIRE(list.size == 0);
+    REQUIRE(values_of(list).empty());
+}
+
+TEST_CASE("Remove link after another", "[islist]")
+{
+    std::array<Item, 3> items{{{1, {}}, {2, {}}, {3, {}}}};
+    islist_t list;
+    REQUIRE(dsa_islist_init(&list) == DSA_SUCCESS);
+
+    islist_link_t* link = nullptr;
+    REQUIRE(dsa_islist_remove_after(&list, nullptr, &link) == DSA_EMPTY_LIST);
+
+    for (Item& item : items)
+    {
+        REQUIRE(dsa_islist_push_back(&list, &item.link) == DSA_SUCCESS);
+    }
+
+    REQUIRE(dsa_islist_remove_after(&list, &items[1].link, &link) == DSA_SUCCESS);
+    REQUIRE(value_of(link) == 3);
+    REQUIRE(list.tail == &items[1].link);
+
+    REQUIRE(dsa_islist_remove_after(&list, &items[1].link, &link) == DSA_INVALID_INPUT);
+
+    REQUIRE(dsa_islist_remove_after(&list, nullptr, &link) == DSA_SUCCESS);
+    REQUIRE(value_of(link) == 1);
+    REQUIRE(values_of(list) == std::vector<int>{2});
+}
@@ -0,0 +1,140 @@
+#include "dsa/list/lf_stack.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+void count_destroyed(void* data)
+{
+    ++*static_cast<int*>(data);
+}
+} // namespace
+
+TEST_CASE("Lock-free stack handles invalid input", "[lf_stack][error]")
+{
+    lf_stack_t stack = nullptr;
+    REQUIRE(dsa_lf_stack_create(nullptr, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_lf_stack_create(&stack, nullptr) == DSA_SUCCESS);
+
+    int value = 1;
+    void* data = nullptr;
+    bool empty = false;
+    REQUIRE(dsa_lf_stack_push(nullptr, &value) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_lf_stack_push(stack, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_lf_stack_pop(nullptr, &data) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_lf_stack_pop(stack, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_lf_stack_is_empty(stack, nullptr) == DSA_INVALID_INPUT);
+
+    dsa_lf_stack_destroy(stack);
+    dsa_lf_stack_destroy(nullptr);
+}
+
+TEST_CASE("Lock-free stack is LIFO", "[lf_stack]")
+{
+    lf_stack_t stack = nullptr;
+    REQUIRE(dsa_lf_stack_create(&stack, nullptr) == DSA_SUCCESS);
+
+    bool empty = false;
+    REQUIRE(dsa_lf_stack_is_empty(stack, &empty) == DSA_SUCCESS);
+    REQUIRE(empty);
+
+    // Enough elements to span several chunks of the node pool.
+    std::vector<int> values(1000);
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        values[i] = static_cast<int>(i);
+        REQUIRE(dsa_lf_stack_push(stack, &values[i]) == DSA_SUCCESS);
+    }
+
+    REQUIRE(dsa_lf_stack_is_empty(stack, &empty) == DSA_SUCCESS);
+    REQUIRE_FALSE(empty);
+
+    for (size_t i = values.size(); i > 0; i--)
+    {
+        void* data = nullptr;
+        REQUIRE(dsa_lf_stack_pop(stack, &data) == DSA_SUCCESS);
+        REQUIRE(data == &values[i - 1]);
+    }
+
+    void* data = nullptr;
+    REQUIRE(dsa_lf_stack_pop(stack, &data) == DSA_EMPTY_LIST);
+
+    dsa_lf_stack_destroy(stack);
+}
+
+TEST_CASE("Lock-free stack destroys remaining elements", "[lf_stack]")
+{
+    lf_stack_t stack = nullptr;
+    REQUIRE(dsa_lf_stack_create(&stack, count_destroyed) == DSA_SUCCESS);
+
+    int counters[] = {0, 0, 0};
+    for (int& counter : counters)
+    {
+        REQUIRE(dsa_lf_stack_push(stack, &counter) == DSA_SUCCESS);
+    }
+
+    void* data = nullptr;
+    REQUIRE(dsa_lf_stack_pop(stack, &data) == DSA_SUCCESS);
+    REQUIRE(data == &counters[2]);
+
+    dsa_lf_stack_destroy(stack);
+    REQUIRE(counters[0] == 1);
+    REQUIRE(counters[1] == 1);
+    REQUIRE(counters[2] == 0);
+}
+
+TEST_CASE("Lock-free stack stress test with concurrent producers and consumers", "[lf_stack][stress]")
+{
+    constexpr size_t thread_count = 4;
+    constexpr size_t items_per_thread = 20000;
+
+    lf_stack_t stack = nullptr;
+    REQUIRE(dsa_lf_stack_create(&stack, nullptr) == DSA_SUCCESS);
+
+    std::vector<int> items(thread_count * items_per_thread);
+    std::vector<std::atomic<int>> seen(items.size());
+    std::atomic<size_t> popped{0};
+    std::atomic<bool> failed{false};
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < thread_count; t++)
+    {
+        threads.emplace_back([&, t] {
+            for (size_t i = t * items_per_thread; i < (t + 1) * items_per_thread; i++)
+            {
+                if (dsa_lf_stack_push(stack, &items[i]) != DSA_SUCCESS)
+                {
+                    failed = true;
+                }
+            }
+        });
+        threads.emplace_back([&] {
+            while (popped.load() < items.size())
+            {
+                void* data = nullptr;
+                if (dsa_lf_stack_pop(stack, &data) == DSA_SUCCESS)
+                {
+                    const auto index = static_cast<size_t>(static_cast<int*>(data) - items.data());
+                    seen[index].fetch_add(1);
+                    popped.fetch_add(1);
+                }
+            }
+        });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    REQUIRE_FALSE(failed.load());
+    REQUIRE(popped.load() == items.size());
+    REQUIRE(std::all_of(seen.begin(), seen.end(), [](const std::atomic<int>& count) { return count.load() == 1; }));
+
+    dsa_lf_stack_destroy(stack);
+}
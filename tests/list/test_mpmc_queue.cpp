@@ -0,0 +1,207 @@
+#include "dsa/list/mpmc_queue.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+void count_destroyed(void* data)
+{
+    ++*static_cast<int*>(data);
+}
+} // namespace
+
+TEST_CASE("MPMC queue handles invalid input", "[mpmc_queue][error]")
+{
+    mpmc_queue_t queue = nullptr;
+    REQUIRE(dsa_mpmc_queue_create(nullptr, 4, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_mpmc_queue_create(&queue, 0, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_mpmc_queue_create(&queue, 4, nullptr) == DSA_SUCCESS);
+
+    int value = 0;
+    void* data = nullptr;
+    void* batch[] = {&value, nullptr};
+    size_t count = 0;
+
+    REQUIRE(dsa_mpmc_queue_try_push(nullptr, &value) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_mpmc_queue_try_push(queue, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_mpmc_queue_push(queue, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_mpmc_queue_try_pop(queue, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_mpmc_queue_pop(nullptr, &data) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_mpmc_queue_try_push_n(queue, batch, 2, &count) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_mpmc_queue_try_push_n(queue, batch, 0, &count) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_mpmc_queue_try_pop_n(queue, batch, 2, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_mpmc_queue_get_capacity(queue, nullptr) == DSA_INVALID_INPUT);
+
+    dsa_mpmc_queue_destroy(queue);
+    dsa_mpmc_queue_destroy(nullptr);
+}
+
+TEST_CASE("MPMC queue is a bounded FIFO", "[mpmc_queue]")
+{
+    mpmc_queue_t queue = nullptr;
+    REQUIRE(dsa_mpmc_queue_create(&queue, 3, nullptr) == DSA_SUCCESS);
+
+    size_t capacity = 0;
+    REQUIRE(dsa_mpmc_queue_get_capacity(queue, &capacity) == DSA_SUCCESS);
+    REQUIRE(capacity == 4);
+
+    std::array<int, 5> values{0, 1, 2, 3, 4};
+    void* data = nullptr;
+
+    // Wrap around the ring several times.
+    for (int round = 0; round < 3; round++)
+    {
+        REQUIRE(dsa_mpmc_queue_try_pop(queue, &data) == DSA_EMPTY_LIST);
+
+        for (size_t i = 0; i < capacity; i++)
+        {
+            REQUIRE(dsa_mpmc_queue_try_push(queue, &values[i]) == DSA_SUCCESS);
+        }
+        REQUIRE(dsa_mpmc_queue_try_push(queue, &values[4]) == DSA_FULL);
+
+        for (size_t i = 0; i < capacity; i++)
+        {
+            REQUIRE(dsa_mpmc_queue_pop(queue, &data) == DSA_SUCCESS);
+            REQUIRE(data == &values[i]);
+        }
+    }
+
+    dsa_mpmc_queue_destroy(queue);
+}
+
+TEST_CASE("MPMC queue batch operations", "[mpmc_queue]")
+{
+    mpmc_queue_t queue = nullptr;
+    REQUIRE(dsa_mpmc_queue_create(&queue, 4, nullptr) == DSA_SUCCESS);
+
+    std::array<int, 6> values{0, 1, 2, 3, 4, 5};
+    std::array<void*, 6> input{};
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        input[i] = &values[i];
+    }
+
+    size_t pushed = 0;
+    REQUIRE(dsa_mpmc_queue_try_push_n(queue, input.data(), input.size(), &pushed) == DSA_SUCCESS);
+    REQUIRE(pushed == 4);
+    REQUIRE(dsa_mpmc_queue_try_push_n(queue, input.data(), input.size(), &pushed) == DSA_FULL);
+    REQUIRE(pushed == 0);
+
+    std::array<void*, 6> output{};
+    size_t popped = 0;
+    REQUIRE(dsa_mpmc_queue_try_pop_n(queue, output.data(), 3, &popped) == DSA_SUCCESS);
+    REQUIRE(popped == 3);
+    REQUIRE(std::equal(output.begin(), output.begin() + 3, input.begin()));
+
+    REQUIRE(dsa_mpmc_queue_try_push_n(queue, input.data() + 4, 2, &pushed) == DSA_SUCCESS);
+    REQUIRE(pushed == 2);
+
+    REQUIRE(dsa_mpmc_queue_try_pop_n(queue, output.data(), output.size(), &popped) == DSA_SUCCESS);
+    REQUIRE(popped == 3);
+    REQUIRE(output[0] == input[3]);
+    REQUIRE(output[1] == input[4]);
+    REQUIRE(output[2] == input[5]);
+
+    REQUIRE(dsa_mpmc_queue_try_pop_n(queue, output.data(), output.size(), &popped) == DSA_EMPTY_LIST);
+    REQUIRE(popped == 0);
+
+    dsa_mpmc_queue_destroy(queue);
+}
+
+TEST_CASE("MPMC queue destroys remaining elements", "[mpmc_queue]")
+{
+    mpmc_queue_t queue = nullptr;
+    REQUIRE(dsa_mpmc_queue_create(&queue, 4, count_destroyed) == DSA_SUCCESS);
+
+    std::array<int, 3> counters{0, 0, 0};
+    for (int& counter : counters)
+    {
+        REQUIRE(dsa_mpmc_queue_try_push(queue, &counter) == DSA_SUCCESS);
+    }
+
+    void* data = nullptr;
+    REQUIRE(dsa_mpmc_queue_try_pop(queue, &data) == DSA_SUCCESS);
+
+    dsa_mpmc_queue_destroy(queue);
+    REQUIRE(counters == std::array<int, 3>{0, 1, 1});
+}
+
+TEST_CASE("MPMC queue stress test with concurrent producers and consumers", "[mpmc_queue][stress]")
+{
+    constexpr size_t producer_count = 4;
+    constexpr size_t consumer_count = 4;
+    constexpr size_t items_per_producer = 20000;
+
+    mpmc_queue_t queue = nullptr;
+    REQUIRE(dsa_mpmc_queue_create(&queue, 64, nullptr) == DSA_SUCCESS);
+
+    std::vector<int> items(producer_count * items_per_producer);
+    std::vector<std::atomic<int>> seen(items.size());
+    std::atomic<size_t> remaining{items.size()};
+
+    std::vector<std::thread> threads;
+    for (size_t p = 0; p < producer_count; p++)
+    {
+        threads.emplace_back([&, p] {
+            const size_t begin = p * items_per_producer;
+            for (size_t i = begin; i < begin + items_per_producer;)
+            {
+                // Mix single and batch pushes.
+                if (i % 3 == 0)
+                {
+                    dsa_mpmc_queue_push(queue, &items[i]);
+                    ++i;
+                    continue;
+                }
+
+                std::array<void*, 8> batch{};
+                const size_t count = std::min(batch.size(), begin + items_per_producer - i);
+                for (size_t j = 0; j < count; j++)
+                {
+                    batch[j] = &items[i + j];
+                }
+                size_t pushed = 0;
+                dsa_mpmc_queue_try_push_n(queue, batch.data(), count, &pushed);
+                i += pushed;
+            }
+        });
+    }
+
+    for (size_t c = 0; c < consumer_count; c++)
+    {
+        threads.emplace_back([&] {
+            std::array<void*, 8> batch{};
+            while (remaining.load() > 0)
+            {
+                size_t popped = 0;
+                if (dsa_mpmc_queue_try_pop_n(queue, batch.data(), batch.size(), &popped) != DSA_SUCCESS)
+                {
+                    continue;
+                }
+                for (size_t j = 0; j < popped; j++)
+                {
+                    seen[static_cast<size_t>(static_cast<int*>(batch[j]) - items.data())].fetch_add(1);
+                }
+                remaining.fetch_sub(popped);
+            }
+        });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    REQUIRE(std::all_of(seen.begin(), seen.end(), [](const std::atomic<int>& count) { return count.load() == 1; }));
+
+    void* data = nullptr;
+    REQUIRE(dsa_mpmc_queue_try_pop(queue, &data) == DSA_EMPTY_LIST);
+
+    dsa_mpmc_queue_destroy(queue);
+}
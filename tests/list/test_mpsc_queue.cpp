@@ -0,0 +1,142 @@
+#include "dsa/list/mpsc_queue.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <thread>
+#include <vector>
+
+namespace
+{
+struct Message
+{
+    size_t producer;
+    size_t sequence;
+    mpsc_queue_link_t link;
+};
+
+Message* message_of(mpsc_queue_link_t* link)
+{
+    return DSA_CONTAINER_OF(link, Message, link);
+}
+
+void count_destroyed(void* data)
+{
+    ++message_of(static_cast<mpsc_queue_link_t*>(data))->sequence;
+}
+} // namespace
+
+TEST_CASE("MPSC queue handles invalid input", "[mpsc_queue][error]")
+{
+    mpsc_queue_t queue = nullptr;
+    REQUIRE(dsa_mpsc_queue_create(nullptr, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_mpsc_queue_create(&queue, nullptr) == DSA_SUCCESS);
+
+    Message message{};
+    mpsc_queue_link_t* link = nullptr;
+    REQUIRE(dsa_mpsc_queue_push(nullptr, &message.link) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_mpsc_queue_push(queue, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_mpsc_queue_pop(nullptr, &link) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_mpsc_queue_pop(queue, nullptr) == DSA_INVALID_INPUT);
+
+    dsa_mpsc_queue_destroy(queue);
+    dsa_mpsc_queue_destroy(nullptr);
+}
+
+TEST_CASE("MPSC queue is FIFO", "[mpsc_queue]")
+{
+    mpsc_queue_t queue = nullptr;
+    REQUIRE(dsa_mpsc_queue_create(&queue, nullptr) == DSA_SUCCESS);
+
+    mpsc_queue_link_t* link = nullptr;
+    REQUIRE(dsa_mpsc_queue_pop(queue, &link) == DSA_EMPTY_LIST);
+
+    std::vector<Message> messages(5);
+    for (size_t round = 0; round < 2; round++)
+    {
+        for (size_t i = 0; i < messages.size(); i++)
+        {
+            messages[i].sequence = i;
+            REQUIRE(dsa_mpsc_queue_push(queue, &messages[i].link) == DSA_SUCCESS);
+        }
+
+        for (size_t i = 0; i < messages.size(); i++)
+        {
+            REQUIRE(dsa_mpsc_queue_pop(queue, &link) == DSA_SUCCESS);
+            REQUIRE(message_of(link)->sequence == i);
+        }
+
+        REQUIRE(dsa_mpsc_queue_pop(queue, &link) == DSA_EMPTY_LIST);
+    }
+
+    dsa_mpsc_queue_destroy(queue);
+}
+
+TEST_CASE("MPSC queue destroys remaining elements", "[mpsc_queue]")
+{
+    mpsc_queue_t queue = nullptr;
+    REQUIRE(dsa_mpsc_queue_create(&queue, count_destroyed) == DSA_SUCCESS);
+
+    std::vector<Message> messages(3);
+    for (Message& message : messages)
+    {
+        REQUIRE(dsa_mpsc_queue_push(queue, &message.link) == DSA_SUCCESS);
+    }
+
+    mpsc_queue_link_t* link = nullptr;
+    REQUIRE(dsa_mpsc_queue_pop(queue, &link) == DSA_SUCCESS);
+
+    dsa_mpsc_queue_destroy(queue);
+    REQUIRE(messages[0].sequence == 0);
+    REQUIRE(messages[1].sequence == 1);
+    REQUIRE(messages[2].sequence == 1);
+}
+
+TEST_CASE("MPSC queue stress test preserves per-producer order", "[mpsc_queue][stress]")
+{
+    constexpr size_t producer_count = 4;
+    constexpr size_t messages_per_producer = 20000;
+
+    mpsc_queue_t queue = nullptr;
+    REQUIRE(dsa_mpsc_queue_create(&queue, nullptr) == DSA_SUCCESS);
+
+    std::vector<Message> messages(producer_count * messages_per_producer);
+    std::vector<std::thread> producers;
+    for (size_t p = 0; p < producer_count; p++)
+    {
+        producers.emplace_back([&, p] {
+            for (size_t i = 0; i < messages_per_producer; i++)
+            {
+                Message& message = messages[p * messages_per_producer + i];
+                message.producer = p;
+                message.sequence = i;
+                dsa_mpsc_queue_push(queue, &message.link);
+            }
+        });
+    }
+
+    std::vector<size_t> next_sequence(producer_count, 0);
+    size_t received = 0;
+    bool in_order = true;
+    while (received < messages.size())
+    {
+        mpsc_queue_link_t* link = nullptr;
+        if (dsa_mpsc_queue_pop(queue, &link) == DSA_SUCCESS)
+        {
+            const Message* message = message_of(link);
+            in_order = in_order && message->sequence == next_sequence[message->producer];
+            ++next_sequence[message->producer];
+            ++received;
+        }
+    }
+
+    for (std::thread& producer : producers)
+    {
+        producer.join();
+    }
+
+    REQUIRE(in_order);
+    mpsc_queue_link_t* link = nullptr;
+    REQUIRE(dsa_mpsc_queue_pop(queue, &link) == DSA_EMPTY_LIST);
+
+    dsa_mpsc_queue_destroy(queue);
+}
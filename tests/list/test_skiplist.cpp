@@ -0,0 +1,259 @@
+#include "dsa/list/skiplist.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <random>
+#include <set>
+#include <vector>
+
+namespace
+{
+int compare_ints(const void* elem, const void* key)
+{
+    const int a = *static_cast<const int*>(elem);
+    const int b = *static_cast<const int*>(key);
+    return (a > b) - (a < b);
+}
+
+void destroy_int(void* data)
+{
+    delete static_cast<int*>(data);
+}
+
+void collect(void* data, void* ctx)
+{
+    static_cast<std::vector<int>*>(ctx)->push_back(*static_cast<int*>(data));
+}
+
+std::vector<int> values_of(skiplist_t list)
+{
+    std::vector<int> values;
+    skiplist_iterator_t it = nullptr;
+    REQUIRE(dsa_skiplist_begin(list, &it) == DSA_SUCCESS);
+    while (it)
+    {
+        void* data = nullptr;
+        REQUIRE(dsa_skiplist_get(it, &data) == DSA_SUCCESS);
+        values.push_back(*static_cast<int*>(data));
+        REQUIRE(dsa_skiplist_next(&it) == DSA_SUCCESS);
+    }
+    return values;
+}
+
+struct counting_ctx
+{
+    size_t allocations = 0;
+    size_t live_bytes = 0;
+};
+
+void* counting_allocate(void* ctx, size_t size)
+{
+    auto* counts = static_cast<counting_ctx*>(ctx);
+    ++counts->allocations;
+    counts->live_bytes += size;
+    return std::malloc(size);
+}
+
+void counting_deallocate(void* ctx, void* ptr, size_t size)
+{
+    static_cast<counting_ctx*>(ctx)->live_bytes -= size;
+    std::free(ptr);
+}
+} // namespace
+
+TEST_CASE("Create and destroy skip list", "[skiplist]")
+{
+    skiplist_t list = nullptr;
+    REQUIRE(dsa_skiplist_create(nullptr, compare_ints, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_skiplist_create(&list, nullptr, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_skiplist_create(&list, compare_ints, nullptr) == DSA_SUCCESS);
+    REQUIRE(list != nullptr);
+
+    bool is_empty = false;
+    REQUIRE(dsa_skiplist_is_empty(list, &is_empty) == DSA_SUCCESS);
+    REQUIRE(is_empty);
+
+    skiplist_iterator_t it = nullptr;
+    REQUIRE(dsa_skiplist_begin(list, &it) == DSA_SUCCESS);
+    REQUIRE(it == nullptr);
+
+    dsa_skiplist_destroy(list);
+    dsa_skiplist_destroy(nullptr);
+}
+
+TEST_CASE("Insert keeps elements sorted and unique", "[skiplist]")
+{
+    skiplist_t list = nullptr;
+    REQUIRE(dsa_skiplist_create(&list, compare_ints, nullptr) == DSA_SUCCESS);
+
+    int values[] = {5, 1, 4, 2, 3};
+    for (int& value : values)
+    {
+        bool inserted = false;
+        REQUIRE(dsa_skiplist_insert(list, &value, &inserted) == DSA_SUCCESS);
+        REQUIRE(inserted);
+    }
+
+    int duplicate = 3;
+    bool inserted = true;
+    REQUIRE(dsa_skiplist_insert(list, &duplicate, &inserted) == DSA_SUCCESS);
+    REQUIRE_FALSE(inserted);
+    REQUIRE(dsa_skiplist_insert(list, nullptr, nullptr) == DSA_INVALID_INPUT);
+
+    size_t size = 0;
+    REQUIRE(dsa_skiplist_get_size(list, &size) == DSA_SUCCESS);
+    REQUIRE(size == 5);
+    REQUIRE(values_of(list) == std::vector<int>{1, 2, 3, 4, 5});
+
+    void* found = nullptr;
+    REQUIRE(dsa_skiplist_find(list, &duplicate, &found) == DSA_SUCCESS);
+    REQUIRE(found == &values[4]);
+
+    int missing = 7;
+    REQUIRE(dsa_skiplist_find(list, &missing, &found) == DSA_SUCCESS);
+    REQUIRE(found == nullptr);
+
+    dsa_skiplist_destroy(list);
+}
+
+TEST_CASE("Erase elements and call destroy callback", "[skiplist]")
+{
+    skiplist_t list = nullptr;
+    REQUIRE(dsa_skiplist_create(&list, compare_ints, destroy_int) == DSA_SUCCESS);
+
+    for (int i = 0; i < 10; i++)
+    {
+        REQUIRE(dsa_skiplist_insert(list, new int(i), nullptr) == DSA_SUCCESS);
+    }
+
+    for (int key : {0, 9, 4})
+    {
+        bool erased = false;
+        REQUIRE(dsa_skiplist_erase(list, &key, &erased) == DSA_SUCCESS);
+        REQUIRE(erased);
+    }
+
+    int missing = 4;
+    bool erased = true;
+    REQUIRE(dsa_skiplist_erase(list, &missing, &erased) == DSA_SUCCESS);
+    REQUIRE_FALSE(erased);
+
+    REQUIRE(values_of(list) == std::vector<int>{1, 2, 3, 5, 6, 7, 8});
+
+    REQUIRE(dsa_skiplist_clear(list) == DSA_SUCCESS);
+    REQUIRE(values_of(list).empty());
+
+    REQUIRE(dsa_skiplist_insert(list, new int(42), nullptr) == DSA_SUCCESS);
+    REQUIRE(values_of(list) == std::vector<int>{42});
+
+    dsa_skiplist_destroy(list);
+}
+
+TEST_CASE("Lower bound and range scans", "[skiplist]")
+{
+    skiplist_t list = nullptr;
+    REQUIRE(dsa_skiplist_create(&list, compare_ints, nullptr) == DSA_SUCCESS);
+
+    std::vector<int> values = {10, 20, 30, 40, 50};
+    for (int& value : values)
+    {
+        REQUIRE(dsa_skiplist_insert(list, &value, nullptr) == DSA_SUCCESS);
+    }
+
+    int key = 25;
+    skiplist_iterator_t it = nullptr;
+    REQUIRE(dsa_skiplist_lower_bound(list, &key, &it) == DSA_SUCCESS);
+    void* data = nullptr;
+    REQUIRE(dsa_skiplist_get(it, &data) == DSA_SUCCESS);
+    REQUIRE(*static_cast<int*>(data) == 30);
+
+    key = 30;
+    REQUIRE(dsa_skiplist_lower_bound(list, &key, &it) == DSA_SUCCESS);
+    REQUIRE(dsa_skiplist_get(it, &data) == DSA_SUCCESS);
+    REQUIRE(*static_cast<int*>(data) == 30);
+
+    key = 51;
+    REQUIRE(dsa_skiplist_lower_bound(list, &key, &it) == DSA_SUCCESS);
+    REQUIRE(it == nullptr);
+    REQUIRE(dsa_skiplist_next(&it) == DSA_INVALID_INPUT);
+
+    int first = 20;
+    int last = 45;
+    std::vector<int> visited;
+    REQUIRE(dsa_skiplist_for_each_range(list, &first, &last, collect, &visited) == DSA_SUCCESS);
+    REQUIRE(visited == std::vector<int>{20, 30, 40});
+
+    visited.clear();
+    REQUIRE(dsa_skiplist_for_each_range(list, nullptr, &first, collect, &visited) == DSA_SUCCESS);
+    REQUIRE(visited == std::vector<int>{10});
+
+    visited.clear();
+    REQUIRE(dsa_skiplist_for_each_range(list, &last, nullptr, collect, &visited) == DSA_SUCCESS);
+    REQUIRE(visited == std::vector<int>{50});
+
+    REQUIRE(dsa_skiplist_for_each_range(list, nullptr, nullptr, nullptr, nullptr) == DSA_INVALID_INPUT);
+
+    dsa_skiplist_destroy(list);
+}
+
+TEST_CASE("Skip list matches std::set under random operations", "[skiplist]")
+{
+    skiplist_t list = nullptr;
+    REQUIRE(dsa_skiplist_create(&list, compare_ints, destroy_int) == DSA_SUCCESS);
+
+    std::set<int> reference;
+    std::mt19937 rng(1234);
+    std::uniform_int_distribution<int> dist(0, 2000);
+
+    for (int i = 0; i < 20000; i++)
+    {
+        int key = dist(rng);
+        if (rng() % 3 == 0)
+        {
+            bool erased = false;
+            REQUIRE(dsa_skiplist_erase(list, &key, &erased) == DSA_SUCCESS);
+            REQUIRE(erased == (reference.erase(key) == 1));
+        }
+        else
+        {
+            int* value = new int(key);
+            bool inserted = false;
+            REQUIRE(dsa_skiplist_insert(list, value, &inserted) == DSA_SUCCESS);
+            REQUIRE(inserted == reference.insert(key).second);
+            if (!inserted)
+            {
+                delete value;
+            }
+        }
+    }
+
+    size_t size = 0;
+    REQUIRE(dsa_skiplist_get_size(list, &size) == DSA_SUCCESS);
+    REQUIRE(size == reference.size());
+    REQUIRE(values_of(list) == std::vector<int>(reference.begin(), reference.end()));
+
+    dsa_skiplist_destroy(list);
+}
+
+TEST_CASE("Skip list obtains all memory from its allocator", "[skiplist]")
+{
+    counting_ctx counts;
+    const dsa_allocator_t counting{counting_allocate, nullptr, counting_deallocate, &counts};
+
+    skiplist_t list = nullptr;
+    REQUIRE(dsa_skiplist_create_with_allocator(&list, compare_ints, destroy_int, &counting) == DSA_SUCCESS);
+
+    for (int i = 0; i < 200; i++)
+    {
+        REQUIRE(dsa_skiplist_insert(list, new int(i), nullptr) == DSA_SUCCESS);
+    }
+    REQUIRE(counts.allocations == 201);
+
+    const int key = 17;
+    REQUIRE(dsa_skiplist_erase(list, &key, nullptr) == DSA_SUCCESS);
+
+    dsa_skiplist_destroy(list);
+    REQUIRE(counts.live_bytes == 0);
+}
@@ -1,8 +1,14 @@
 #include "dsa/list/slist.h"
+#include "dsa/common/arena.h"
+#include "dsa/common/stats.h"
+#include "dsa/common/trace.h"
+#include "dsa/sort/insertion_sort.h"
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <string_view>
 #include <vector>
+#include <cstdlib>
 #include <cstring>
 
 namespace
@@ -11,6 +17,72 @@ void destroy_string(void* data)
 {
     delete[] static_cast<char*>(data);
 }
+
+void count_destroyed(void* data)
+{
+    ++*static_cast<int*>(data);
+}
+
+void sum_values(void* data, void* ctx)
+{
+    *static_cast<int*>(ctx) += *static_cast<int*>(data);
+}
+
+bool is_even(const void* data, void*)
+{
+    return *static_cast<const int*>(data) % 2 == 0;
+}
+
+bool is_greater_than(const void* data, void* ctx)
+{
+    return *static_cast<const int*>(data) > *static_cast<int*>(ctx);
+}
+
+std::vector<size_t> batch_sizes;
+
+void count_destroyed_batch(void** data, size_t count)
+{
+    batch_sizes.push_back(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        count_destroyed(data[i]);
+    }
+}
+
+std::vector<int> values_of(slist_t list)
+{
+    std::vector<int> values;
+    slist_iterator_t it = nullptr;
+    REQUIRE(dsa_slist_begin(list, &it) == DSA_SUCCESS);
+    while (it)
+    {
+        void* data = nullptr;
+        REQUIRE(dsa_slist_get(it, &data) == DSA_SUCCESS);
+        values.push_back(*static_cast<int*>(data));
+        REQUIRE(dsa_slist_next(&it) == DSA_SUCCESS);
+    }
+    return values;
+}
+
+struct counting_ctx
+{
+    size_t allocations = 0;
+    size_t live_bytes = 0;
+};
+
+void* counting_allocate(void* ctx, size_t size)
+{
+    auto* counts = static_cast<counting_ctx*>(ctx);
+    ++counts->allocations;
+    counts->live_bytes += size;
+    return std::malloc(size);
+}
+
+void counting_deallocate(void* ctx, void* ptr, size_t size)
+{
+    static_cast<counting_ctx*>(ctx)->live_bytes -= size;
+    std::free(ptr);
+}
 } // namespace
 
 TEST_CASE("Create and destroy slist")
@@ -162,3 +234,517 @@ TEST_CASE("Destroy list with custom destroy callback")
 
     dsa_slist_destroy(list);
 }
+
+TEST_CASE("Push back many elements at once")
+{
+    slist_t list = nullptr;
+    REQUIRE(dsa_slist_create(&list, nullptr) == DSA_SUCCESS);
+
+    std::vector<int> values(1000);
+    std::vector<void*> pointers;
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        values[i] = static_cast<int>(i);
+        pointers.push_back(&values[i]);
+    }
+
+    REQUIRE(dsa_slist_push_back(list, pointers[0]) == DSA_SUCCESS);
+    REQUIRE(dsa_slist_push_back_n(list, pointers.data() + 1, pointers.size() - 1) == DSA_SUCCESS);
+
+    size_t size = 0;
+    REQUIRE(dsa_slist_get_size(list, &size) == DSA_SUCCESS);
+    REQUIRE(size == values.size());
+
+    std::vector<void*> exported(size);
+    REQUIRE(dsa_slist_to_array(list, exported.data(), exported.size()) == DSA_SUCCESS);
+    REQUIRE(exported == pointers);
+
+    // Nodes from the shared block are released one by one.
+    for (size_t i = 0; i < 500; i++)
+    {
+        REQUIRE(dsa_slist_pop_front(list) == DSA_SUCCESS);
+    }
+    REQUIRE(dsa_slist_pop_back(list) == DSA_SUCCESS);
+
+    void* head = nullptr;
+    REQUIRE(dsa_slist_get_head(list, &head) == DSA_SUCCESS);
+    REQUIRE(*static_cast<int*>(head) == 500);
+
+    dsa_slist_destroy(list);
+}
+
+TEST_CASE("Push back many elements rejects invalid input")
+{
+    slist_t list = nullptr;
+    REQUIRE(dsa_slist_create(&list, nullptr) == DSA_SUCCESS);
+
+    int a = 1;
+    void* with_null[] = {&a, nullptr};
+
+    REQUIRE(dsa_slist_push_back_n(nullptr, with_null, 1) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_slist_push_back_n(list, nullptr, 1) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_slist_push_back_n(list, with_null, 0) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_slist_push_back_n(list, with_null, 2) == DSA_INVALID_INPUT);
+
+    bool empty = false;
+    REQUIRE(dsa_slist_is_empty(list, &empty) == DSA_SUCCESS);
+    REQUIRE(empty == true);
+
+    dsa_slist_destroy(list);
+}
+
+TEST_CASE("Splice lists")
+{
+    slist_t first = nullptr;
+    slist_t second = nullptr;
+    REQUIRE(dsa_slist_create(&first, destroy_string) == DSA_SUCCESS);
+    REQUIRE(dsa_slist_create(&second, destroy_string) == DSA_SUCCESS);
+
+    const char* words[] = {"one", "two", "three", "four"};
+    std::vector<void*> strings;
+    for (const char* word : words)
+    {
+        char* copy = new char[std::strlen(word) + 1];
+        std::strcpy(copy, word);
+        strings.push_back(copy);
+    }
+
+    REQUIRE(dsa_slist_push_back(first, strings[0]) == DSA_SUCCESS);
+    REQUIRE(dsa_slist_push_back_n(second, strings.data() + 1, 3) == DSA_SUCCESS);
+
+    REQUIRE(dsa_slist_splice(first, second) == DSA_SUCCESS);
+
+    size_t size = 0;
+    REQUIRE(dsa_slist_get_size(first, &size) == DSA_SUCCESS);
+    REQUIRE(size == 4);
+    REQUIRE(dsa_slist_get_size(second, &size) == DSA_SUCCESS);
+    REQUIRE(size == 0);
+
+    void* tail = nullptr;
+    REQUIRE(dsa_slist_get_tail(first, &tail) == DSA_SUCCESS);
+    REQUIRE(strcmp(static_cast<const char*>(tail), "four") == 0);
+
+    // The source list stays usable after being spliced.
+    REQUIRE(dsa_slist_splice(first, second) == DSA_SUCCESS);
+    REQUIRE(dsa_slist_get_size(first, &size) == DSA_SUCCESS);
+    REQUIRE(size == 4);
+
+    dsa_slist_destroy(second);
+    dsa_slist_destroy(first);
+}
+
+TEST_CASE("Splice rejects invalid input")
+{
+    slist_t first = nullptr;
+    slist_t second = nullptr;
+    REQUIRE(dsa_slist_create(&first, nullptr) == DSA_SUCCESS);
+    REQUIRE(dsa_slist_create(&second, destroy_string) == DSA_SUCCESS);
+
+    REQUIRE(dsa_slist_splice(first, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_slist_splice(first, first) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_slist_splice(first, second) == DSA_INVALID_INPUT);
+
+    dsa_slist_destroy(second);
+    dsa_slist_destroy(first);
+}
+
+TEST_CASE("Export list to array")
+{
+    slist_t list = nullptr;
+    REQUIRE(dsa_slist_create(&list, nullptr) == DSA_SUCCESS);
+
+    REQUIRE(dsa_slist_push_back(list, (void*)"A") == DSA_SUCCESS);
+    REQUIRE(dsa_slist_push_back(list, (void*)"B") == DSA_SUCCESS);
+
+    void* array[2] = {nullptr, nullptr};
+    REQUIRE(dsa_slist_to_array(list, array, 1) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_slist_to_array(list, nullptr, 2) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_slist_to_array(list, array, 2) == DSA_SUCCESS);
+
+    REQUIRE(strcmp(static_cast<const char*>(array[0]), "A") == 0);
+    REQUIRE(strcmp(static_cast<const char*>(array[1]), "B") == 0);
+
+    dsa_slist_destroy(list);
+}
+
+TEST_CASE("Iterate over list")
+{
+    slist_t list = nullptr;
+    REQUIRE(dsa_slist_create(&list, nullptr) == DSA_SUCCESS);
+
+    slist_iterator_t it = nullptr;
+    REQUIRE(dsa_slist_begin(list, &it) == DSA_SUCCESS);
+    REQUIRE(it == nullptr);
+
+    int values[] = {1, 2, 3};
+    for (int& value : values)
+    {
+        REQUIRE(dsa_slist_push_back(list, &value) == DSA_SUCCESS);
+    }
+
+    REQUIRE(values_of(list) == std::vector<int>{1, 2, 3});
+
+    void* data = nullptr;
+    REQUIRE(dsa_slist_begin(nullptr, &it) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_slist_next(nullptr) == DSA_INVALID_INPUT);
+    it = nullptr;
+    REQUIRE(dsa_slist_next(&it) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_slist_get(nullptr, &data) == DSA_INVALID_INPUT);
+
+    dsa_slist_destroy(list);
+}
+
+TEST_CASE("Apply operation to each list element")
+{
+    slist_t list = nullptr;
+    REQUIRE(dsa_slist_create(&list, nullptr) == DSA_SUCCESS);
+
+    int sum = 0;
+    REQUIRE(dsa_slist_for_each(list, sum_values, &sum) == DSA_SUCCESS);
+    REQUIRE(sum == 0);
+
+    int values[] = {1, 2, 3, 4};
+    for (int& value : values)
+    {
+        REQUIRE(dsa_slist_push_back(list, &value) == DSA_SUCCESS);
+    }
+
+    REQUIRE(dsa_slist_for_each(list, sum_values, &sum) == DSA_SUCCESS);
+    REQUIRE(sum == 10);
+
+    REQUIRE(dsa_slist_for_each(nullptr, sum_values, &sum) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_slist_for_each(list, nullptr, &sum) == DSA_INVALID_INPUT);
+
+    dsa_slist_destroy(list);
+}
+
+TEST_CASE("Remove elements matching a predicate")
+{
+    slist_t list = nullptr;
+    REQUIRE(dsa_slist_create(&list, nullptr) == DSA_SUCCESS);
+
+    int values[] = {2, 1, 4, 3, 6, 5, 8};
+    for (int& value : values)
+    {
+        REQUIRE(dsa_slist_push_back(list, &value) == DSA_SUCCESS);
+    }
+
+    size_t removed = 0;
+    REQUIRE(dsa_slist_remove_if(list, is_even, nullptr, &removed) == DSA_SUCCESS);
+    REQUIRE(removed == 4);
+    REQUIRE(values_of(list) == std::vector<int>{1, 3, 5});
+
+    void* tail = nullptr;
+    REQUIRE(dsa_slist_get_tail(list, &tail) == DSA_SUCCESS);
+    REQUIRE(*static_cast<int*>(tail) == 5);
+
+    // The list remains usable after its tail was removed.
+    REQUIRE(dsa_slist_push_back(list, &values[6]) == DSA_SUCCESS);
+    REQUIRE(values_of(list) == std::vector<int>{1, 3, 5, 8});
+
+    int threshold = 0;
+    REQUIRE(dsa_slist_remove_if(list, is_greater_than, &threshold, nullptr) == DSA_SUCCESS);
+
+    size_t size = 1;
+    REQUIRE(dsa_slist_get_size(list, &size) == DSA_SUCCESS);
+    REQUIRE(size == 0);
+
+    REQUIRE(dsa_slist_remove_if(list, nullptr, nullptr, nullptr) == DSA_INVALID_INPUT);
+
+    dsa_slist_destroy(list);
+}
+
+TEST_CASE("Remove elements calls destroy callback")
+{
+    slist_t list = nullptr;
+    REQUIRE(dsa_slist_create(&list, count_destroyed) == DSA_SUCCESS);
+
+    int counters[] = {0, 1, 0};
+    for (int& counter : counters)
+    {
+        REQUIRE(dsa_slist_push_back(list, &counter) == DSA_SUCCESS);
+    }
+
+    int threshold = 0;
+    REQUIRE(dsa_slist_remove_if(list, is_greater_than, &threshold, nullptr) == DSA_SUCCESS);
+    REQUIRE(counters[0] == 0);
+    REQUIRE(counters[1] == 2);
+    REQUIRE(counters[2] == 0);
+
+    dsa_slist_destroy(list);
+    REQUIRE(counters[0] == 1);
+    REQUIRE(counters[2] == 1);
+}
+
+TEST_CASE("Clear and destroy use the batched destroy callback")
+{
+    batch_sizes.clear();
+
+    slist_t list = nullptr;
+    REQUIRE(dsa_slist_create(&list, count_destroyed) == DSA_SUCCESS);
+    REQUIRE(dsa_slist_set_destroy_batch(list, count_destroyed_batch) == DSA_SUCCESS);
+
+    std::vector<int> counters(100, 0);
+    for (int& counter : counters)
+    {
+        REQUIRE(dsa_slist_push_back(list, &counter) == DSA_SUCCESS);
+    }
+
+    REQUIRE(dsa_slist_clear(list) == DSA_SUCCESS);
+    REQUIRE(batch_sizes == std::vector<size_t>{64, 36});
+    for (int counter : counters)
+    {
+        REQUIRE(counter == 1);
+    }
+
+    REQUIRE(dsa_slist_push_back(list, &counters[0]) == DSA_SUCCESS);
+    REQUIRE(dsa_slist_pop_front(list) == DSA_SUCCESS);
+    REQUIRE(batch_sizes.back() == 1);
+    REQUIRE(counters[0] == 2);
+
+    REQUIRE(dsa_slist_push_back(list, &counters[1]) == DSA_SUCCESS);
+    dsa_slist_destroy(list);
+    REQUIRE(counters[1] == 2);
+
+    REQUIRE(dsa_slist_set_destroy_batch(nullptr, count_destroyed_batch) == DSA_INVALID_INPUT);
+}
+
+TEST_CASE("Detach list and reclaim the chain incrementally")
+{
+    slist_t list = nullptr;
+    REQUIRE(dsa_slist_create(&list, count_destroyed) == DSA_SUCCESS);
+
+    std::vector<int> counters(10, 0);
+    std::vector<void*> items;
+    for (int& counter : counters)
+    {
+        items.push_back(&counter);
+    }
+    REQUIRE(dsa_slist_push_back_n(list, items.data(), 5) == DSA_SUCCESS);
+    for (size_t i = 5; i < items.size(); i++)
+    {
+        REQUIRE(dsa_slist_push_back(list, items[i]) == DSA_SUCCESS);
+    }
+
+    slist_chain_t chain;
+    REQUIRE(dsa_slist_detach(list, &chain) == DSA_SUCCESS);
+    REQUIRE(chain.size == 10);
+
+    bool is_empty = false;
+    REQUIRE(dsa_slist_is_empty(list, &is_empty) == DSA_SUCCESS);
+    REQUIRE(is_empty);
+    for (int counter : counters)
+    {
+        REQUIRE(counter == 0);
+    }
+
+    // The list is independent of the detached chain.
+    int other = 0;
+    REQUIRE(dsa_slist_push_back(list, &other) == DSA_SUCCESS);
+    dsa_slist_destroy(list);
+    REQUIRE(other == 1);
+
+    size_t remaining = 0;
+    REQUIRE(dsa_slist_chain_reclaim(&chain, 3, &remaining) == DSA_SUCCESS);
+    REQUIRE(remaining == 7);
+    REQUIRE(counters[2] == 1);
+    REQUIRE(counters[3] == 0);
+
+    REQUIRE(dsa_slist_chain_reclaim(&chain, 0, &remaining) == DSA_SUCCESS);
+    REQUIRE(remaining == 0);
+    for (int counter : counters)
+    {
+        REQUIRE(counter == 1);
+    }
+
+    REQUIRE(dsa_slist_chain_reclaim(&chain, 0, nullptr) == DSA_SUCCESS);
+    REQUIRE(dsa_slist_chain_reclaim(nullptr, 0, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_slist_detach(nullptr, &chain) == DSA_INVALID_INPUT);
+}
+
+TEST_CASE("List obtains all memory from its allocator")
+{
+    counting_ctx counts;
+    const dsa_allocator_t counting{counting_allocate, nullptr, counting_deallocate, &counts};
+
+    slist_t list = nullptr;
+    REQUIRE(dsa_slist_create_with_allocator(&list, nullptr, &counting) == DSA_SUCCESS);
+
+    int values[6] = {1, 2, 3, 4, 5, 6};
+    void* items[3] = {&values[0], &values[1], &values[2]};
+    REQUIRE(dsa_slist_push_back_n(list, items, 3) == DSA_SUCCESS);
+    REQUIRE(dsa_slist_push_back(list, &values[3]) == DSA_SUCCESS);
+    REQUIRE(dsa_slist_push_front(list, &values[4]) == DSA_SUCCESS);
+    REQUIRE(counts.allocations == 4);
+    REQUIRE(values_of(list) == std::vector<int>{5, 1, 2, 3, 4});
+
+    SECTION("Destroy returns every byte")
+    {
+        dsa_slist_destroy(list);
+        REQUIRE(counts.live_bytes == 0);
+    }
+
+    SECTION("Detached chains release nodes through the list's allocator")
+    {
+        slist_chain_t chain;
+        REQUIRE(dsa_slist_detach(list, &chain) == DSA_SUCCESS);
+        dsa_slist_destroy(list);
+        REQUIRE(counts.live_bytes > 0);
+
+        REQUIRE(dsa_slist_chain_reclaim(&chain, 0, nullptr) == DSA_SUCCESS);
+        REQUIRE(counts.live_bytes == 0);
+    }
+
+    SECTION("Splice requires equal allocators")
+    {
+        slist_t other = nullptr;
+        REQUIRE(dsa_slist_create(&other, nullptr) == DSA_SUCCESS);
+        REQUIRE(dsa_slist_push_back(other, &values[5]) == DSA_SUCCESS);
+        REQUIRE(dsa_slist_splice(list, other) == DSA_INVALID_INPUT);
+        dsa_slist_destroy(other);
+
+        REQUIRE(dsa_slist_create_with_allocator(&other, nullptr, &counting) == DSA_SUCCESS);
+        REQUIRE(dsa_slist_push_back(other, &values[5]) == DSA_SUCCESS);
+        REQUIRE(dsa_slist_splice(list, other) == DSA_SUCCESS);
+        REQUIRE(values_of(list) == std::vector<int>{5, 1, 2, 3, 4, 6});
+        dsa_slist_destroy(other);
+        dsa_slist_destroy(list);
+        REQUIRE(counts.live_bytes == 0);
+    }
+}
+
+TEST_CASE("Create list with an incomplete allocator")
+{
+    const dsa_allocator_t incomplete{counting_allocate, nullptr, nullptr, nullptr};
+
+    slist_t list = nullptr;
+    REQUIRE(dsa_slist_create_with_allocator(&list, nullptr, &incomplete) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_slist_create_with_allocator(nullptr, nullptr, nullptr) == DSA_INVALID_INPUT);
+}
+
+TEST_CASE("Per-request list built in an arena is discarded with one reset")
+{
+    dsa_arena_t arena = nullptr;
+    REQUIRE(dsa_arena_create(&arena, nullptr) == DSA_SUCCESS);
+
+    dsa_allocator_t allocator;
+    REQUIRE(dsa_arena_get_allocator(arena, &allocator) == DSA_SUCCESS);
+
+    for (int request = 0; request < 3; request++)
+    {
+        slist_t list = nullptr;
+        REQUIRE(dsa_slist_create_with_allocator(&list, nullptr, &allocator) == DSA_SUCCESS);
+
+        int values[100];
+        for (int i = 0; i < 100; i++)
+        {
+            values[i] = (i * 37 + request) % 100;
+            REQUIRE(dsa_slist_push_back(list, &values[i]) == DSA_SUCCESS);
+        }
+
+        REQUIRE(dsa_insertion_sort_with_allocator(values, 100, sizeof(int),
+                                                  [](const void* a, const void* b) {
+                                                      const int lhs = *static_cast<const int*>(a);
+                                                      const int rhs = *static_cast<const int*>(b);
+                                                      return (lhs > rhs) - (lhs < rhs);
+                                                  },
+                                                  &allocator) == DSA_SUCCESS);
+        REQUIRE(values_of(list).front() == 0);
+
+        // The list is abandoned instead of destroyed; the reset releases all of its nodes.
+        REQUIRE(dsa_arena_reset(arena) == DSA_SUCCESS);
+    }
+
+    size_t capacity = 0;
+    REQUIRE(dsa_arena_get_capacity(arena, &capacity) == DSA_SUCCESS);
+    REQUIRE(capacity <= size_t{64} * 1024);
+
+    dsa_arena_destroy(arena);
+}
+
+TEST_CASE("List operations report their allocations and predicate calls")
+{
+    // The counters only advance when the library is built with DSA_ENABLE_STATS.
+    const uint64_t scale = dsa_stats_enabled() ? 1 : 0;
+    dsa_stats_t stats{};
+
+    dsa_stats_reset();
+    slist_t list = nullptr;
+    REQUIRE(dsa_slist_create(&list, nullptr) == DSA_SUCCESS);
+
+    int values[] = {1, 2, 3, 4, 5};
+    for (int& value : values)
+    {
+        REQUIRE(dsa_slist_push_back(list, &value) == DSA_SUCCESS);
+    }
+
+    REQUIRE(dsa_stats_snapshot(&stats) == DSA_SUCCESS);
+    REQUIRE(stats.allocations == 6 * scale);
+    REQUIRE(stats.deallocations == 0);
+
+    dsa_stats_reset();
+    REQUIRE(dsa_slist_remove_if(list, is_even, nullptr, nullptr) == DSA_SUCCESS);
+    REQUIRE(dsa_slist_pop_front(list) == DSA_SUCCESS);
+
+    REQUIRE(dsa_stats_snapshot(&stats) == DSA_SUCCESS);
+    REQUIRE(stats.comparisons == 5 * scale);
+    REQUIRE(stats.deallocations == 3 * scale);
+    REQUIRE(stats.allocations == 0);
+
+    dsa_stats_reset();
+    dsa_slist_destroy(list);
+
+    REQUIRE(dsa_stats_snapshot(&stats) == DSA_SUCCESS);
+    REQUIRE(stats.deallocations == 3 * scale);
+}
+
+TEST_CASE("Push and pop mark their entry and exit for tracing")
+{
+    std::vector<dsa_trace_event_t> events;
+    auto record = [](const dsa_trace_event_t* event, void* ctx) { static_cast<std::vector<dsa_trace_event_t>*>(ctx)->push_back(*event); };
+
+    slist_t list = nullptr;
+    REQUIRE(dsa_slist_create(&list, nullptr) == DSA_SUCCESS);
+    REQUIRE(dsa_trace_set_hook(record, &events) == DSA_SUCCESS);
+
+    int first = 1;
+    int second = 2;
+    REQUIRE(dsa_slist_push_front(list, &first) == DSA_SUCCESS);
+    REQUIRE(dsa_slist_push_back(list, &second) == DSA_SUCCESS);
+    REQUIRE(dsa_slist_pop_back(list) == DSA_SUCCESS);
+    REQUIRE(dsa_slist_pop_front(list) == DSA_SUCCESS);
+    REQUIRE(dsa_slist_pop_front(list) == DSA_EMPTY_LIST);
+
+    REQUIRE(dsa_trace_set_hook(nullptr, nullptr) == DSA_SUCCESS);
+    dsa_slist_destroy(list);
+
+    // The trace points only exist when the library is built with DSA_ENABLE_TRACING.
+    if (!dsa_trace_enabled())
+    {
+        REQUIRE(events.empty());
+        return;
+    }
+
+    struct expected_event
+    {
+        std::string_view probe;
+        dsa_trace_phase_t phase;
+        size_t size;
+    };
+    const expected_event expected[] = {
+        {"slist_push_front", DSA_TRACE_PHASE_ENTRY, 0}, {"slist_push_front", DSA_TRACE_PHASE_EXIT, 1},
+        {"slist_push_back", DSA_TRACE_PHASE_ENTRY, 1},  {"slist_push_back", DSA_TRACE_PHASE_EXIT, 2},
+        {"slist_pop_back", DSA_TRACE_PHASE_ENTRY, 2},   {"slist_pop_back", DSA_TRACE_PHASE_EXIT, 1},
+        {"slist_pop_front", DSA_TRACE_PHASE_ENTRY, 1},  {"slist_pop_front", DSA_TRACE_PHASE_EXIT, 0},
+        {"slist_pop_front", DSA_TRACE_PHASE_ENTRY, 0},  {"slist_pop_front", DSA_TRACE_PHASE_EXIT, 0},
+    };
+
+    REQUIRE(events.size() == std::size(expected));
+    for (size_t i = 0; i < events.size(); i++)
+    {
+        REQUIRE(std::string_view{events[i].probe} == expected[i].probe);
+        REQUIRE(events[i].phase == expected[i].phase);
+        REQUIRE(events[i].size == expected[i].size);
+        REQUIRE(events[i].elem_size == sizeof(void*));
+    }
+}
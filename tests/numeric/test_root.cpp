@@ -4,7 +4,10 @@
 #include <array>
 #include <cmath>
 #include <numbers>
+#include <string_view>
+#include <vector>
 
+#include "dsa/common/trace.h"
 #include "dsa/numeric/root.h"
 
 namespace
@@ -179,3 +182,33 @@ TEST_CASE("Checking root on boundary", "[root_newton]")
     REQUIRE(dsa_find_root_newton(f, g, x.data(), &n, delta) == DSA_ROOT_SUCCESS);
     REQUIRE_THAT(x[n - 1], Catch::Matchers::WithinAbs(0.0, delta));
 }
+
+TEST_CASE("Newton's method reports the number of iterations on exit", "[root_newton][trace]")
+{
+    std::vector<dsa_trace_event_t> events;
+    auto record = [](const dsa_trace_event_t* event, void* ctx) { static_cast<std::vector<dsa_trace_event_t>*>(ctx)->push_back(*event); };
+    REQUIRE(dsa_trace_set_hook(record, &events) == DSA_SUCCESS);
+
+    auto f = [](double x) { return x * x - 4.0; };
+    auto g = [](double x) { return 2.0 * x; };
+    std::array<double, 20> x{};
+    x[0] = 1.0;
+    size_t n = x.size();
+    REQUIRE(dsa_find_root_newton(f, g, x.data(), &n, delta) == DSA_ROOT_SUCCESS);
+    REQUIRE(dsa_trace_set_hook(nullptr, nullptr) == DSA_SUCCESS);
+
+    // The trace points only exist when the library is built with DSA_ENABLE_TRACING.
+    if (!dsa_trace_enabled())
+    {
+        REQUIRE(events.empty());
+        return;
+    }
+
+    REQUIRE(events.size() == 2);
+    REQUIRE(std::string_view{events[0].probe} == "find_root_newton");
+    REQUIRE(events[0].phase == DSA_TRACE_PHASE_ENTRY);
+    REQUIRE(events[0].size == x.size());
+    REQUIRE(events[1].phase == DSA_TRACE_PHASE_EXIT);
+    REQUIRE(events[1].size == n);
+    REQUIRE(events[1].elem_size == sizeof(double));
+}
@@ -6,6 +6,7 @@
 #include <cstring>
 #include <vector>
 
+#include "dsa/common/stats.h"
 #include "dsa/search/binary_search.h"
 
 template <typename T>
@@ -280,3 +281,37 @@ TEST_CASE("Binary search with const char*", "[BinarySearch][CString]")
         REQUIRE(found_index == size - 4);
     }
 }
+
+TEST_CASE("Binary search reports its comparisons", "[BinarySearch][Stats]")
+{
+    // The counters only advance when the library is built with DSA_ENABLE_STATS.
+    const uint64_t scale = dsa_stats_enabled() ? 1 : 0;
+    const std::vector<int> sorted{1, 2, 3, 4, 5, 6, 7};
+    size_t found_index = 0;
+    dsa_stats_t stats{};
+
+    SECTION("Target in the middle is found with one comparison")
+    {
+        const int target = 4;
+        dsa_stats_reset();
+        REQUIRE(dsa_binary_search_index(&target, sorted.data(), sorted.size(), sizeof(int), ascending_compare<int>, &found_index) ==
+                DSA_SUCCESS);
+        REQUIRE(dsa_stats_snapshot(&stats) == DSA_SUCCESS);
+
+        REQUIRE(found_index == 3);
+        REQUIRE(stats.comparisons == 1 * scale);
+    }
+
+    SECTION("Missing target takes a comparison per halving")
+    {
+        const int target = 8;
+        dsa_stats_reset();
+        REQUIRE(dsa_binary_search_index(&target, sorted.data(), sorted.size(), sizeof(int), ascending_compare<int>, &found_index) ==
+                DSA_SUCCESS);
+        REQUIRE(dsa_stats_snapshot(&stats) == DSA_SUCCESS);
+
+        REQUIRE(found_index == sorted.size());
+        REQUIRE(stats.comparisons == 3 * scale);
+        REQUIRE(stats.moves == 0);
+    }
+}
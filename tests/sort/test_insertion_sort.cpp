@@ -5,10 +5,15 @@
 #include <array>
 #include <cmath>
 #include <cstdint>
+#include <cstdlib>
 #include <cstring>
 #include <numeric>
 #include <random>
+#include <string_view>
+#include <vector>
 
+#include "dsa/common/stats.h"
+#include "dsa/common/trace.h"
 #include "dsa/sort/insertion_sort.h"
 
 struct CharWithIndex
@@ -278,3 +283,151 @@ TEST_CASE("Insertion sort with const char*", "[InsertionSort][CString]")
         }));
     }
 }
+
+namespace
+{
+struct counting_ctx
+{
+    size_t allocations = 0;
+    size_t live_bytes = 0;
+};
+
+void* counting_allocate(void* ctx, size_t size)
+{
+    auto* counts = static_cast<counting_ctx*>(ctx);
+    ++counts->allocations;
+    counts->live_bytes += size;
+    return std::malloc(size);
+}
+
+void counting_deallocate(void* ctx, void* ptr, size_t size)
+{
+    static_cast<counting_ctx*>(ctx)->live_bytes -= size;
+    std::free(ptr);
+}
+
+struct LargeRecord
+{
+    int key;
+    char payload[124];
+};
+
+int compare_large_records(const void* first, const void* second)
+{
+    const int lhs = static_cast<const LargeRecord*>(first)->key;
+    const int rhs = static_cast<const LargeRecord*>(second)->key;
+    return (lhs > rhs) - (lhs < rhs);
+}
+
+int compare_ints_ascending(const void* first, const void* second)
+{
+    const int lhs = *static_cast<const int*>(first);
+    const int rhs = *static_cast<const int*>(second);
+    return (lhs > rhs) - (lhs < rhs);
+}
+} // namespace
+
+TEST_CASE("Insertion sort takes scratch memory from the given allocator", "[InsertionSort][Allocator]")
+{
+    counting_ctx counts;
+    const dsa_allocator_t counting{counting_allocate, nullptr, counting_deallocate, &counts};
+
+    SECTION("Small elements do not allocate")
+    {
+        std::array<int, 5> input{5, 3, 4, 1, 2};
+        REQUIRE(dsa_insertion_sort_with_allocator(input.data(), input.size(), sizeof(int), compare_ints_ascending, &counting) ==
+                DSA_SUCCESS);
+        REQUIRE(std::ranges::is_sorted(input));
+        REQUIRE(counts.allocations == 0);
+    }
+
+    SECTION("Large elements use the allocator")
+    {
+        std::array<LargeRecord, 4> input{};
+        const int keys[] = {3, 1, 4, 2};
+        for (size_t i = 0; i < input.size(); i++)
+        {
+            input[i].key = keys[i];
+        }
+
+        REQUIRE(dsa_insertion_sort_with_allocator(input.data(), input.size(), sizeof(LargeRecord), compare_large_records, &counting) ==
+                DSA_SUCCESS);
+        REQUIRE(std::ranges::is_sorted(input, {}, &LargeRecord::key));
+        REQUIRE(counts.allocations == 1);
+        REQUIRE(counts.live_bytes == 0);
+    }
+}
+
+TEST_CASE("Insertion sort reports its comparisons and moves", "[InsertionSort][Stats]")
+{
+    // The counters only advance when the library is built with DSA_ENABLE_STATS.
+    const uint64_t scale = dsa_stats_enabled() ? 1 : 0;
+    dsa_stats_t stats{};
+
+    SECTION("Reversed input shifts every element past all smaller keys")
+    {
+        std::array<int, 4> input{4, 3, 2, 1};
+        dsa_stats_reset();
+        REQUIRE(dsa_insertion_sort(input.data(), input.size(), sizeof(int), compare_ints_ascending) == DSA_SUCCESS);
+        REQUIRE(dsa_stats_snapshot(&stats) == DSA_SUCCESS);
+
+        REQUIRE(stats.comparisons == 6 * scale);
+        REQUIRE(stats.moves == 12 * scale);
+        REQUIRE(stats.allocations == 0);
+    }
+
+    SECTION("Sorted input needs one comparison per element")
+    {
+        std::array<int, 4> input{1, 2, 3, 4};
+        dsa_stats_reset();
+        REQUIRE(dsa_insertion_sort(input.data(), input.size(), sizeof(int), compare_ints_ascending) == DSA_SUCCESS);
+        REQUIRE(dsa_stats_snapshot(&stats) == DSA_SUCCESS);
+
+        REQUIRE(stats.comparisons == 3 * scale);
+        REQUIRE(stats.moves == 6 * scale);
+    }
+
+    SECTION("Large keys are counted as allocations")
+    {
+        std::array<LargeRecord, 2> input{};
+        input[0].key = 2;
+        input[1].key = 1;
+        dsa_stats_reset();
+        REQUIRE(dsa_insertion_sort(input.data(), input.size(), sizeof(LargeRecord), compare_large_records) == DSA_SUCCESS);
+        REQUIRE(dsa_stats_snapshot(&stats) == DSA_SUCCESS);
+
+        REQUIRE(stats.allocations == 1 * scale);
+        REQUIRE(stats.allocated_bytes == sizeof(LargeRecord) * scale);
+        REQUIRE(stats.deallocations == 1 * scale);
+    }
+}
+
+TEST_CASE("Insertion sort marks its entry and exit for tracing", "[InsertionSort][Trace]")
+{
+    std::vector<dsa_trace_event_t> events;
+    auto record = [](const dsa_trace_event_t* event, void* ctx) { static_cast<std::vector<dsa_trace_event_t>*>(ctx)->push_back(*event); };
+    REQUIRE(dsa_trace_set_hook(record, &events) == DSA_SUCCESS);
+
+    std::array<int, 5> input{5, 1, 4, 2, 3};
+    REQUIRE(dsa_insertion_sort(input.data(), input.size(), sizeof(int), compare_ints_ascending) == DSA_SUCCESS);
+    REQUIRE(dsa_insertion_sort(nullptr, input.size(), sizeof(int), compare_ints_ascending) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_trace_set_hook(nullptr, nullptr) == DSA_SUCCESS);
+
+    // The trace points only exist when the library is built with DSA_ENABLE_TRACING;
+    // rejected calls are not traced.
+    if (!dsa_trace_enabled())
+    {
+        REQUIRE(events.empty());
+        return;
+    }
+
+    REQUIRE(events.size() == 2);
+    for (const dsa_trace_event_t& event : events)
+    {
+        REQUIRE(std::string_view{event.probe} == "insertion_sort");
+        REQUIRE(event.size == 5);
+        REQUIRE(event.elem_size == sizeof(int));
+    }
+    REQUIRE(events[0].phase == DSA_TRACE_PHASE_ENTRY);
+    REQUIRE(events[1].phase == DSA_TRACE_PHASE_EXIT);
+}
@@ -3,6 +3,9 @@
 #include "dsa/utility/for_each.h"
 
 #include <array>
+#include <cstdlib>
+#include <numeric>
+#include <vector>
 
 namespace
 {
@@ -20,6 +23,46 @@ void scale_int_with_factor(void* element, void* context)
     (*val) *= factor;
 }
 
+void add_to_sum(void* element, void* context)
+{
+    *static_cast<long long*>(context) += *static_cast<int*>(element);
+}
+
+struct span_record
+{
+    std::vector<size_t> lengths;
+    long long sum = 0;
+};
+
+void record_span(void* first, size_t count, void* context)
+{
+    auto* record = static_cast<span_record*>(context);
+    const int* values = static_cast<const int*>(first);
+    record->lengths.push_back(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        record->sum += values[i];
+    }
+}
+
+struct allocation_counts
+{
+    size_t allocations = 0;
+    size_t deallocations = 0;
+};
+
+void* counting_allocate(void* ctx, size_t size)
+{
+    ++static_cast<allocation_counts*>(ctx)->allocations;
+    return std::malloc(size);
+}
+
+void counting_deallocate(void* ctx, void* ptr, size_t)
+{
+    ++static_cast<allocation_counts*>(ctx)->deallocations;
+    std::free(ptr);
+}
+
 } // namespace
 
 TEST_CASE("dsa_for_each handles invalid input", "[dsa_for_each]")
@@ -86,3 +129,136 @@ TEST_CASE("dsa_for_each_ctx applies context-aware operation", "[dsa_for_each]")
         REQUIRE(arr == expected);
     }
 }
+
+TEST_CASE("dsa_for_each_span passes consecutive blocks", "[dsa_for_each]")
+{
+    std::vector<int> arr(10);
+    std::iota(arr.begin(), arr.end(), 1);
+
+    SECTION("Explicit span size")
+    {
+        span_record record;
+        REQUIRE(dsa_for_each_span(arr.data(), arr.size(), sizeof(int), 4, record_span, &record) == DSA_SUCCESS);
+        REQUIRE(record.lengths == std::vector<size_t>{4, 4, 2});
+        REQUIRE(record.sum == 55);
+    }
+
+    SECTION("Default span size covers a small array in one block")
+    {
+        span_record record;
+        REQUIRE(dsa_for_each_span(arr.data(), arr.size(), sizeof(int), 0, record_span, &record) == DSA_SUCCESS);
+        REQUIRE(record.lengths == std::vector<size_t>{10});
+        REQUIRE(record.sum == 55);
+    }
+
+    SECTION("Invalid input")
+    {
+        span_record record;
+        REQUIRE(dsa_for_each_span(nullptr, arr.size(), sizeof(int), 4, record_span, &record) == DSA_INVALID_INPUT);
+        REQUIRE(dsa_for_each_span(arr.data(), 0, sizeof(int), 4, record_span, &record) == DSA_INVALID_INPUT);
+        REQUIRE(dsa_for_each_span(arr.data(), arr.size(), 0, 4, record_span, &record) == DSA_INVALID_INPUT);
+        REQUIRE(dsa_for_each_span(arr.data(), arr.size(), sizeof(int), 4, nullptr, &record) == DSA_INVALID_INPUT);
+        REQUIRE(record.lengths.empty());
+    }
+}
+
+TEST_CASE("dsa_for_each_parallel handles invalid input", "[dsa_for_each]")
+{
+    std::vector<int> arr(16, 1);
+    int factor = 3;
+
+    REQUIRE(dsa_for_each_parallel(nullptr, arr.size(), sizeof(int), scale_int_with_factor, &factor, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_for_each_parallel(arr.data(), 0, sizeof(int), scale_int_with_factor, &factor, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_for_each_parallel(arr.data(), arr.size(), 0, scale_int_with_factor, &factor, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_for_each_parallel(arr.data(), arr.size(), sizeof(int), nullptr, &factor, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_for_each_parallel(arr.data(), arr.size(), sizeof(int), scale_int_with_factor, nullptr, nullptr) == DSA_INVALID_INPUT);
+
+    void* contexts[] = {&factor};
+    dsa_parallel_options_t options{};
+    options.thread_ctx = contexts;
+    REQUIRE(dsa_for_each_parallel(arr.data(), arr.size(), sizeof(int), scale_int_with_factor, nullptr, &options) == DSA_INVALID_INPUT);
+}
+
+TEST_CASE("dsa_for_each_parallel visits every element once", "[dsa_for_each]")
+{
+    std::vector<int> arr(10007);
+    std::iota(arr.begin(), arr.end(), 0);
+    int factor = 2;
+
+    dsa_parallel_options_t options{};
+    SECTION("Default options")
+    {
+        REQUIRE(dsa_for_each_parallel(arr.data(), arr.size(), sizeof(int), scale_int_with_factor, &factor, nullptr) == DSA_SUCCESS);
+    }
+
+    SECTION("More workers than chunks")
+    {
+        options.num_threads = 8;
+        options.chunk_size = 4096;
+        REQUIRE(dsa_for_each_parallel(arr.data(), arr.size(), sizeof(int), scale_int_with_factor, &factor, &options) == DSA_SUCCESS);
+    }
+
+    SECTION("Small chunks")
+    {
+        options.num_threads = 4;
+        options.chunk_size = 3;
+        REQUIRE(dsa_for_each_parallel(arr.data(), arr.size(), sizeof(int), scale_int_with_factor, &factor, &options) == DSA_SUCCESS);
+    }
+
+    SECTION("Explicit executor")
+    {
+        dsa_executor_options_t executor_options{};
+        executor_options.num_threads = 3;
+        REQUIRE(dsa_executor_create(&options.executor, &executor_options) == DSA_SUCCESS);
+
+        options.chunk_size = 64;
+        REQUIRE(dsa_for_each_parallel(arr.data(), arr.size(), sizeof(int), scale_int_with_factor, &factor, &options) == DSA_SUCCESS);
+
+        dsa_executor_destroy(options.executor);
+    }
+
+    SECTION("Caller-supplied allocator")
+    {
+        allocation_counts counts;
+        const dsa_allocator_t counting{counting_allocate, nullptr, counting_deallocate, &counts};
+        options.num_threads = 4;
+        options.allocator = &counting;
+
+        REQUIRE(dsa_for_each_parallel(arr.data(), arr.size(), sizeof(int), scale_int_with_factor, &factor, &options) == DSA_SUCCESS);
+        REQUIRE(counts.allocations == 1);
+        REQUIRE(counts.deallocations == 1);
+    }
+
+    SECTION("Executor running on the calling thread")
+    {
+        dsa_executor_options_t executor_options{};
+        executor_options.run_on_caller = true;
+        REQUIRE(dsa_executor_create(&options.executor, &executor_options) == DSA_SUCCESS);
+
+        REQUIRE(dsa_for_each_parallel(arr.data(), arr.size(), sizeof(int), scale_int_with_factor, &factor, &options) == DSA_SUCCESS);
+
+        dsa_executor_destroy(options.executor);
+    }
+
+    for (size_t i = 0; i < arr.size(); i++)
+    {
+        REQUIRE(arr[i] == static_cast<int>(2 * i));
+    }
+}
+
+TEST_CASE("dsa_for_each_parallel passes per-thread contexts", "[dsa_for_each]")
+{
+    std::vector<int> arr(5000);
+    std::iota(arr.begin(), arr.end(), 1);
+
+    std::array<long long, 4> sums{};
+    std::array<void*, 4> contexts{&sums[0], &sums[1], &sums[2], &sums[3]};
+
+    dsa_parallel_options_t options{};
+    options.num_threads = contexts.size();
+    options.chunk_size = 16;
+    options.thread_ctx = contexts.data();
+
+    REQUIRE(dsa_for_each_parallel(arr.data(), arr.size(), sizeof(int), add_to_sum, nullptr, &options) == DSA_SUCCESS);
+    REQUIRE(std::accumulate(sums.begin(), sums.end(), 0LL) == 5000LL * 5001 / 2);
+}
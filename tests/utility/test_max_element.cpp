@@ -1,10 +1,17 @@
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 
+#include "dsa/common/cpu.h"
 #include "dsa/utility/max_element.h"
 
 #include <array>
+#include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
 
 namespace
 {
@@ -183,3 +190,85 @@ TEST_CASE("dsa_max_element_index with invalid input parameters", "[dsa_max_eleme
         REQUIRE(status == DSA_INVALID_INPUT);
     }
 }
+
+TEST_CASE("dsa_max_element_index typed variants agree with the generic version", "[dsa_max_element_index]")
+{
+    // Run both the portable kernels and the best ones this machine supports.
+    const dsa_cpu_level_t level = GENERATE(DSA_CPU_LEVEL_SCALAR, dsa_cpu_detect());
+    REQUIRE(dsa_cpu_force_level(level) == DSA_SUCCESS);
+
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> dist(-50, 50);
+
+    for (size_t size = 1; size < 100; size++)
+    {
+        std::vector<int32_t> ints(size);
+        std::vector<double> doubles(size);
+        std::vector<float> floats(size);
+        for (size_t i = 0; i < size; i++)
+        {
+            ints[i] = dist(rng);
+            doubles[i] = ints[i] / 4.0;
+            floats[i] = static_cast<float>(ints[i]) / 4.0f;
+        }
+
+        size_t expected{};
+        REQUIRE(dsa_max_element_index(ints.data(), size, sizeof(int32_t), compare_int, &expected) == DSA_SUCCESS);
+
+        size_t index = size;
+        REQUIRE(dsa_max_element_index_i32(ints.data(), size, &index) == DSA_SUCCESS);
+        REQUIRE(index == expected);
+        REQUIRE(dsa_max_element_index_f64(doubles.data(), size, &index) == DSA_SUCCESS);
+        REQUIRE(index == expected);
+        REQUIRE(dsa_max_element_index_f32(floats.data(), size, &index) == DSA_SUCCESS);
+        REQUIRE(index == expected);
+    }
+
+    REQUIRE(dsa_cpu_force_level(dsa_cpu_detect()) == DSA_SUCCESS);
+}
+
+TEST_CASE("dsa_max_element_index typed variants ignore NaN", "[dsa_max_element_index]")
+{
+    constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+    size_t index = 0;
+
+    SECTION("NaN at the start and in the middle")
+    {
+        std::vector<double> arr(37, 1.0);
+        arr[0] = nan;
+        arr[5] = nan;
+        arr[20] = 5.0;
+        arr[30] = 5.0;
+        REQUIRE(dsa_max_element_index_f64(arr.data(), arr.size(), &index) == DSA_SUCCESS);
+        REQUIRE(index == 20);
+
+        std::vector<float> floats(arr.begin(), arr.end());
+        REQUIRE(dsa_max_element_index_f32(floats.data(), floats.size(), &index) == DSA_SUCCESS);
+        REQUIRE(index == 20);
+    }
+
+    SECTION("All elements NaN")
+    {
+        std::vector<double> arr(9, nan);
+        REQUIRE(dsa_max_element_index_f64(arr.data(), arr.size(), &index) == DSA_SUCCESS);
+        REQUIRE(index == 0);
+    }
+
+    SECTION("Infinities are regular values")
+    {
+        std::vector<double> arr(12, nan);
+        arr[3] = -std::numeric_limits<double>::infinity();
+        REQUIRE(dsa_max_element_index_f64(arr.data(), arr.size(), &index) == DSA_SUCCESS);
+        REQUIRE(index == 3);
+    }
+
+    SECTION("Invalid input")
+    {
+        REQUIRE(dsa_max_element_index_f64(nullptr, 3, &index) == DSA_INVALID_INPUT);
+        double value = 1.0;
+        REQUIRE(dsa_max_element_index_f64(&value, 0, &index) == DSA_INVALID_INPUT);
+        REQUIRE(dsa_max_element_index_f64(&value, 1, nullptr) == DSA_INVALID_INPUT);
+        int32_t number = 1;
+        REQUIRE(dsa_max_element_index_i32(&number, 0, &index) == DSA_INVALID_INPUT);
+    }
+}
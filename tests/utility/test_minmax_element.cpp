@@ -0,0 +1,128 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "dsa/utility/max_element.h"
+#include "dsa/utility/min_element.h"
+#include "dsa/utility/minmax_element.h"
+
+#include <array>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace
+{
+struct Point
+{
+    int x;
+    int y;
+};
+
+int compare_int(const void* a, const void* b)
+{
+    int ia = *static_cast<const int*>(a);
+    int ib = *static_cast<const int*>(b);
+    return (ia > ib) - (ia < ib);
+}
+
+size_t comparisons = 0;
+
+int counting_compare_int(const void* a, const void* b)
+{
+    ++comparisons;
+    return compare_int(a, b);
+}
+
+int compare_point_x(const void* a, const void* b)
+{
+    const Point* pa = static_cast<const Point*>(a);
+    const Point* pb = static_cast<const Point*>(b);
+    return (pa->x > pb->x) - (pa->x < pb->x);
+}
+} // namespace
+
+TEST_CASE("dsa_minmax_element_index finds min and max elements", "[dsa_minmax_element_index]")
+{
+    SECTION("single element")
+    {
+        constexpr std::array<int, 1> arr{7};
+        size_t min_index = 1;
+        size_t max_index = 1;
+
+        REQUIRE(dsa_minmax_element_index(arr.data(), arr.size(), sizeof(int), compare_int, &min_index, &max_index) == DSA_SUCCESS);
+        REQUIRE(min_index == 0);
+        REQUIRE(max_index == 0);
+    }
+
+    SECTION("even and odd sizes")
+    {
+        constexpr std::array<int, 6> arr{3, 9, -2, 4, 11, 0};
+        size_t min_index{};
+        size_t max_index{};
+
+        REQUIRE(dsa_minmax_element_index(arr.data(), arr.size(), sizeof(int), compare_int, &min_index, &max_index) == DSA_SUCCESS);
+        REQUIRE(min_index == 2);
+        REQUIRE(max_index == 4);
+
+        REQUIRE(dsa_minmax_element_index(arr.data(), 5, sizeof(int), compare_int, &min_index, &max_index) == DSA_SUCCESS);
+        REQUIRE(min_index == 2);
+        REQUIRE(max_index == 4);
+    }
+
+    SECTION("ties report the first occurrence")
+    {
+        constexpr std::array<Point, 6> arr{{{2, 0}, {1, 1}, {5, 2}, {1, 3}, {5, 4}, {2, 5}}};
+        size_t min_index{};
+        size_t max_index{};
+
+        REQUIRE(dsa_minmax_element_index(arr.data(), arr.size(), sizeof(Point), compare_point_x, &min_index, &max_index) == DSA_SUCCESS);
+        REQUIRE(arr[min_index].y == 1);
+        REQUIRE(arr[max_index].y == 2);
+
+        constexpr std::array<int, 4> equal{4, 4, 4, 4};
+        REQUIRE(dsa_minmax_element_index(equal.data(), equal.size(), sizeof(int), compare_int, &min_index, &max_index) == DSA_SUCCESS);
+        REQUIRE(min_index == 0);
+        REQUIRE(max_index == 0);
+    }
+}
+
+TEST_CASE("dsa_minmax_element_index agrees with min and max element", "[dsa_minmax_element_index]")
+{
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> dist(0, 20);
+
+    for (size_t size = 1; size < 64; size++)
+    {
+        std::vector<int> arr(size);
+        for (int& value : arr)
+        {
+            value = dist(rng);
+        }
+
+        size_t expected_min{};
+        size_t expected_max{};
+        REQUIRE(dsa_min_element_index(arr.data(), size, sizeof(int), compare_int, &expected_min) == DSA_SUCCESS);
+        REQUIRE(dsa_max_element_index(arr.data(), size, sizeof(int), compare_int, &expected_max) == DSA_SUCCESS);
+
+        comparisons = 0;
+        size_t min_index{};
+        size_t max_index{};
+        REQUIRE(dsa_minmax_element_index(arr.data(), size, sizeof(int), counting_compare_int, &min_index, &max_index) == DSA_SUCCESS);
+        REQUIRE(min_index == expected_min);
+        REQUIRE(max_index == expected_max);
+        REQUIRE(comparisons <= 3 * (size / 2) + 1);
+    }
+}
+
+TEST_CASE("dsa_minmax_element_index handles invalid input", "[dsa_minmax_element_index][error]")
+{
+    constexpr std::array<int, 3> arr{1, 2, 3};
+    size_t min_index{};
+    size_t max_index{};
+
+    REQUIRE(dsa_minmax_element_index(nullptr, arr.size(), sizeof(int), compare_int, &min_index, &max_index) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_minmax_element_index(arr.data(), 0, sizeof(int), compare_int, &min_index, &max_index) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_minmax_element_index(arr.data(), arr.size(), 0, compare_int, &min_index, &max_index) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_minmax_element_index(arr.data(), arr.size(), sizeof(int), nullptr, &min_index, &max_index) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_minmax_element_index(arr.data(), arr.size(), sizeof(int), compare_int, nullptr, &max_index) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_minmax_element_index(arr.data(), arr.size(), sizeof(int), compare_int, &min_index, nullptr) == DSA_INVALID_INPUT);
+}
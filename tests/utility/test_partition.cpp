@@ -0,0 +1,132 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "dsa/utility/partition.h"
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <vector>
+
+namespace
+{
+struct Record
+{
+    int key;
+    int order;
+    char payload[300];
+};
+
+bool is_even(const void* elem, void*)
+{
+    return *static_cast<const int*>(elem) % 2 == 0;
+}
+
+bool is_below(const void* elem, void* ctx)
+{
+    return *static_cast<const int*>(elem) < *static_cast<int*>(ctx);
+}
+
+bool record_is_odd(const void* elem, void*)
+{
+    return static_cast<const Record*>(elem)->key % 2 != 0;
+}
+
+std::vector<int> random_values(size_t count, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> dist(0, 999);
+    std::vector<int> values(count);
+    for (int& value : values)
+    {
+        value = dist(rng);
+    }
+    return values;
+}
+} // namespace
+
+TEST_CASE("dsa_partition splits elements by predicate", "[dsa_partition]")
+{
+    const size_t count = GENERATE(1, 2, 63, 64, 127, 128, 129, 500, 4099);
+    std::vector<int> values = random_values(count, static_cast<unsigned>(count));
+    std::vector<int> sorted_before = values;
+    std::sort(sorted_before.begin(), sorted_before.end());
+
+    int threshold = 300;
+    size_t point = count + 1;
+    REQUIRE(dsa_partition(values.data(), values.size(), sizeof(int), is_below, &threshold, &point) == DSA_SUCCESS);
+
+    REQUIRE(point == static_cast<size_t>(std::count_if(values.begin(), values.end(), [](int v) { return v < 300; })));
+    REQUIRE(std::all_of(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(point), [](int v) { return v < 300; }));
+    REQUIRE(std::none_of(values.begin() + static_cast<std::ptrdiff_t>(point), values.end(), [](int v) { return v < 300; }));
+
+    std::sort(values.begin(), values.end());
+    REQUIRE(values == sorted_before);
+}
+
+TEST_CASE("dsa_partition handles uniform arrays", "[dsa_partition]")
+{
+    std::vector<int> evens(300, 2);
+    size_t point = 0;
+    REQUIRE(dsa_partition(evens.data(), evens.size(), sizeof(int), is_even, nullptr, &point) == DSA_SUCCESS);
+    REQUIRE(point == evens.size());
+
+    std::vector<int> odds(300, 3);
+    REQUIRE(dsa_partition(odds.data(), odds.size(), sizeof(int), is_even, nullptr, &point) == DSA_SUCCESS);
+    REQUIRE(point == 0);
+}
+
+TEST_CASE("dsa_stable_partition preserves relative order", "[dsa_partition]")
+{
+    const size_t count = GENERATE(1, 7, 100, 1001);
+    const size_t scratch_count = GENERATE(0, 1, 16, 2000);
+
+    std::vector<int> values = random_values(count, 99);
+    std::vector<int> expected = values;
+    std::stable_partition(expected.begin(), expected.end(), [](int v) { return v % 2 == 0; });
+
+    std::vector<int> scratch(scratch_count);
+    size_t point = 0;
+    REQUIRE(dsa_stable_partition(values.data(), values.size(), sizeof(int), is_even, nullptr,
+                                 scratch_count ? scratch.data() : nullptr, scratch_count, &point) == DSA_SUCCESS);
+    REQUIRE(values == expected);
+    REQUIRE(point == static_cast<size_t>(std::count_if(values.begin(), values.end(), [](int v) { return v % 2 == 0; })));
+}
+
+TEST_CASE("dsa_stable_partition with large elements", "[dsa_partition]")
+{
+    std::vector<Record> records(50);
+    for (size_t i = 0; i < records.size(); i++)
+    {
+        records[i].key = static_cast<int>(i * 7 % 11);
+        records[i].order = static_cast<int>(i);
+    }
+
+    size_t point = 0;
+    REQUIRE(dsa_stable_partition(records.data(), records.size(), sizeof(Record), record_is_odd, nullptr, nullptr, 0, &point) == DSA_SUCCESS);
+
+    for (size_t i = 0; i < records.size(); i++)
+    {
+        REQUIRE((records[i].key % 2 != 0) == (i < point));
+        if (i > 0 && i != point)
+        {
+            REQUIRE(records[i - 1].order < records[i].order);
+        }
+    }
+}
+
+TEST_CASE("Partition functions handle invalid input", "[dsa_partition][error]")
+{
+    std::array<int, 3> arr{1, 2, 3};
+    size_t point = 0;
+
+    REQUIRE(dsa_partition(nullptr, arr.size(), sizeof(int), is_even, nullptr, &point) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_partition(arr.data(), 0, sizeof(int), is_even, nullptr, &point) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_partition(arr.data(), arr.size(), 0, is_even, nullptr, &point) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_partition(arr.data(), arr.size(), sizeof(int), nullptr, nullptr, &point) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_partition(arr.data(), arr.size(), sizeof(int), is_even, nullptr, nullptr) == DSA_INVALID_INPUT);
+
+    REQUIRE(dsa_stable_partition(nullptr, arr.size(), sizeof(int), is_even, nullptr, nullptr, 0, &point) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_stable_partition(arr.data(), arr.size(), sizeof(int), nullptr, nullptr, nullptr, 0, &point) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_stable_partition(arr.data(), arr.size(), sizeof(int), is_even, nullptr, nullptr, 0, nullptr) == DSA_INVALID_INPUT);
+}
@@ -0,0 +1,120 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "dsa/utility/reduce.h"
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+void add_int(void* acc, const void* elem, void*)
+{
+    *static_cast<long long*>(acc) += *static_cast<const int*>(elem);
+}
+
+void append_digit(void* acc, const void* elem, void* ctx)
+{
+    auto* value = static_cast<int*>(acc);
+    *value = *value * *static_cast<int*>(ctx) + *static_cast<const int*>(elem);
+}
+} // namespace
+
+TEST_CASE("dsa_reduce folds elements in order", "[dsa_reduce]")
+{
+    constexpr std::array<int, 4> arr{1, 2, 3, 4};
+
+    SECTION("Sum with initial value")
+    {
+        long long sum = 10;
+        REQUIRE(dsa_reduce(arr.data(), arr.size(), sizeof(int), &sum, add_int, nullptr) == DSA_SUCCESS);
+        REQUIRE(sum == 20);
+    }
+
+    SECTION("Non-commutative operation with context")
+    {
+        int base = 10;
+        int number = 0;
+        REQUIRE(dsa_reduce(arr.data(), arr.size(), sizeof(int), &number, append_digit, &base) == DSA_SUCCESS);
+        REQUIRE(number == 1234);
+    }
+
+    SECTION("Invalid input")
+    {
+        long long sum = 0;
+        REQUIRE(dsa_reduce(nullptr, arr.size(), sizeof(int), &sum, add_int, nullptr) == DSA_INVALID_INPUT);
+        REQUIRE(dsa_reduce(arr.data(), 0, sizeof(int), &sum, add_int, nullptr) == DSA_INVALID_INPUT);
+        REQUIRE(dsa_reduce(arr.data(), arr.size(), 0, &sum, add_int, nullptr) == DSA_INVALID_INPUT);
+        REQUIRE(dsa_reduce(arr.data(), arr.size(), sizeof(int), nullptr, add_int, nullptr) == DSA_INVALID_INPUT);
+        REQUIRE(dsa_reduce(arr.data(), arr.size(), sizeof(int), &sum, nullptr, nullptr) == DSA_INVALID_INPUT);
+    }
+}
+
+TEST_CASE("Typed reductions", "[dsa_reduce]")
+{
+    std::vector<int32_t> ints(1003);
+    std::vector<double> doubles(ints.size());
+    for (size_t i = 0; i < ints.size(); i++)
+    {
+        ints[i] = static_cast<int32_t>((i * 37) % 101) - 50;
+        doubles[i] = ints[i] * 0.5;
+    }
+
+    SECTION("Sums")
+    {
+        int64_t int_sum = 0;
+        REQUIRE(dsa_reduce_sum_i32(ints.data(), ints.size(), &int_sum) == DSA_SUCCESS);
+        REQUIRE(int_sum == std::accumulate(ints.begin(), ints.end(), int64_t{0}));
+
+        double double_sum = 0.0;
+        REQUIRE(dsa_reduce_sum_f64(doubles.data(), doubles.size(), &double_sum) == DSA_SUCCESS);
+        REQUIRE_THAT(double_sum, Catch::Matchers::WithinAbs(int_sum * 0.5, 1e-9));
+    }
+
+    SECTION("Sum does not overflow 32 bits")
+    {
+        std::vector<int32_t> large(10, std::numeric_limits<int32_t>::max());
+        int64_t sum = 0;
+        REQUIRE(dsa_reduce_sum_i32(large.data(), large.size(), &sum) == DSA_SUCCESS);
+        REQUIRE(sum == 10LL * std::numeric_limits<int32_t>::max());
+    }
+
+    SECTION("Min and max")
+    {
+        int32_t int_min = 0;
+        int32_t int_max = 0;
+        REQUIRE(dsa_reduce_min_i32(ints.data(), ints.size(), &int_min) == DSA_SUCCESS);
+        REQUIRE(dsa_reduce_max_i32(ints.data(), ints.size(), &int_max) == DSA_SUCCESS);
+        REQUIRE(int_min == -50);
+        REQUIRE(int_max == 50);
+
+        doubles[17] = std::numeric_limits<double>::quiet_NaN();
+        double double_min = 0.0;
+        double double_max = 0.0;
+        REQUIRE(dsa_reduce_min_f64(doubles.data(), doubles.size(), &double_min) == DSA_SUCCESS);
+        REQUIRE(dsa_reduce_max_f64(doubles.data(), doubles.size(), &double_max) == DSA_SUCCESS);
+        REQUIRE(double_min == -25.0);
+        REQUIRE(double_max == 25.0);
+
+        std::array<double, 3> nans{std::nan(""), std::nan(""), std::nan("")};
+        REQUIRE(dsa_reduce_min_f64(nans.data(), nans.size(), &double_min) == DSA_SUCCESS);
+        REQUIRE(std::isnan(double_min));
+    }
+
+    SECTION("Invalid input")
+    {
+        int64_t sum = 0;
+        int32_t value = 0;
+        double result = 0.0;
+        REQUIRE(dsa_reduce_sum_i32(nullptr, 1, &sum) == DSA_INVALID_INPUT);
+        REQUIRE(dsa_reduce_sum_i32(ints.data(), 0, &sum) == DSA_INVALID_INPUT);
+        REQUIRE(dsa_reduce_sum_f64(doubles.data(), doubles.size(), nullptr) == DSA_INVALID_INPUT);
+        REQUIRE(dsa_reduce_min_i32(ints.data(), ints.size(), nullptr) == DSA_INVALID_INPUT);
+        REQUIRE(dsa_reduce_max_i32(nullptr, 1, &value) == DSA_INVALID_INPUT);
+        REQUIRE(dsa_reduce_min_f64(doubles.data(), 0, &result) == DSA_INVALID_INPUT);
+    }
+}
@@ -0,0 +1,63 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "dsa/utility/remove_if.h"
+
+#include <array>
+#include <vector>
+
+namespace
+{
+bool is_negative(const void* elem, void*)
+{
+    return *static_cast<const int*>(elem) < 0;
+}
+
+bool counting_is_negative(const void* elem, void* ctx)
+{
+    ++*static_cast<size_t*>(ctx);
+    return is_negative(elem, nullptr);
+}
+} // namespace
+
+TEST_CASE("dsa_remove_if removes matching elements in order", "[dsa_remove_if]")
+{
+    SECTION("Mixed elements")
+    {
+        std::vector<int> arr{-1, 2, -3, 4, 5, -6, 7};
+        size_t calls = 0;
+        size_t new_count = 0;
+        REQUIRE(dsa_remove_if(arr.data(), arr.size(), sizeof(int), counting_is_negative, &calls, &new_count) == DSA_SUCCESS);
+        REQUIRE(calls == 7);
+        REQUIRE(new_count == 4);
+        arr.resize(new_count);
+        REQUIRE(arr == std::vector<int>{2, 4, 5, 7});
+    }
+
+    SECTION("Nothing to remove")
+    {
+        std::array<int, 3> arr{1, 2, 3};
+        size_t new_count = 0;
+        REQUIRE(dsa_remove_if(arr.data(), arr.size(), sizeof(int), is_negative, nullptr, &new_count) == DSA_SUCCESS);
+        REQUIRE(new_count == 3);
+        REQUIRE(arr == std::array<int, 3>{1, 2, 3});
+    }
+
+    SECTION("Everything removed")
+    {
+        std::array<int, 3> arr{-1, -2, -3};
+        size_t new_count = 3;
+        REQUIRE(dsa_remove_if(arr.data(), arr.size(), sizeof(int), is_negative, nullptr, &new_count) == DSA_SUCCESS);
+        REQUIRE(new_count == 0);
+    }
+
+    SECTION("Invalid input")
+    {
+        std::array<int, 3> arr{1, 2, 3};
+        size_t new_count = 0;
+        REQUIRE(dsa_remove_if(nullptr, arr.size(), sizeof(int), is_negative, nullptr, &new_count) == DSA_INVALID_INPUT);
+        REQUIRE(dsa_remove_if(arr.data(), 0, sizeof(int), is_negative, nullptr, &new_count) == DSA_INVALID_INPUT);
+        REQUIRE(dsa_remove_if(arr.data(), arr.size(), 0, is_negative, nullptr, &new_count) == DSA_INVALID_INPUT);
+        REQUIRE(dsa_remove_if(arr.data(), arr.size(), sizeof(int), nullptr, nullptr, &new_count) == DSA_INVALID_INPUT);
+        REQUIRE(dsa_remove_if(arr.data(), arr.size(), sizeof(int), is_negative, nullptr, nullptr) == DSA_INVALID_INPUT);
+    }
+}
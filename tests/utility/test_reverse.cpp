@@ -1,10 +1,14 @@
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 
+#include "dsa/common/cpu.h"
 #include "dsa/utility/reverse.h"
 
 #include <array>
 #include <cstddef>
+#include <cstring>
+#include <vector>
 
 namespace
 {
@@ -182,3 +186,37 @@ TEST_CASE("reverse works with std::max_align_t", "[dsa_reverse]")
     REQUIRE(out1 == 2);
     REQUIRE(out2 == 1);
 }
+
+TEST_CASE("dsa_reverse matches std::reverse for every element size path", "[dsa_reverse]")
+{
+    const size_t elem_size = GENERATE(1, 2, 3, 4, 8, 12, 16, 24, 300);
+    const size_t count = GENERATE(1, 2, 3, 7, 8, 15, 16, 17, 31, 32, 33, 100, 1001);
+    const dsa_cpu_level_t level = GENERATE(DSA_CPU_LEVEL_SCALAR, dsa_cpu_detect());
+    REQUIRE(dsa_cpu_force_level(level) == DSA_SUCCESS);
+
+    std::vector<unsigned char> input(count * elem_size);
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        input[i] = static_cast<unsigned char>(i * 7 + i / 256);
+    }
+
+    std::vector<std::vector<unsigned char>> expected;
+    for (size_t i = count; i-- > 0;)
+    {
+        expected.emplace_back(input.begin() + static_cast<std::ptrdiff_t>(i * elem_size),
+                              input.begin() + static_cast<std::ptrdiff_t>((i + 1) * elem_size));
+    }
+
+    // Offset by one byte so that the blocks are never aligned.
+    std::vector<unsigned char> storage(input.size() + 1);
+    std::memcpy(storage.data() + 1, input.data(), input.size());
+
+    REQUIRE(dsa_reverse(storage.data() + 1, count, elem_size) == DSA_SUCCESS);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        REQUIRE(std::memcmp(storage.data() + 1 + i * elem_size, expected[i].data(), elem_size) == 0);
+    }
+
+    REQUIRE(dsa_cpu_force_level(dsa_cpu_detect()) == DSA_SUCCESS);
+}
@@ -0,0 +1,64 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "dsa/utility/rotate.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <vector>
+
+TEST_CASE("dsa_rotate moves the middle element to the front", "[dsa_rotate]")
+{
+    SECTION("Small int array")
+    {
+        std::array<int, 6> arr{1, 2, 3, 4, 5, 6};
+        REQUIRE(dsa_rotate(arr.data(), arr.size(), sizeof(int), 2) == DSA_SUCCESS);
+        REQUIRE(arr == std::array<int, 6>{3, 4, 5, 6, 1, 2});
+    }
+
+    SECTION("Rotation by 0 or count is a no-op")
+    {
+        std::array<int, 3> arr{1, 2, 3};
+        REQUIRE(dsa_rotate(arr.data(), arr.size(), sizeof(int), 0) == DSA_SUCCESS);
+        REQUIRE(dsa_rotate(arr.data(), arr.size(), sizeof(int), arr.size()) == DSA_SUCCESS);
+        REQUIRE(arr == std::array<int, 3>{1, 2, 3});
+    }
+
+    SECTION("Invalid input")
+    {
+        std::array<int, 3> arr{1, 2, 3};
+        REQUIRE(dsa_rotate(nullptr, arr.size(), sizeof(int), 1) == DSA_INVALID_INPUT);
+        REQUIRE(dsa_rotate(arr.data(), 0, sizeof(int), 0) == DSA_INVALID_INPUT);
+        REQUIRE(dsa_rotate(arr.data(), arr.size(), 0, 1) == DSA_INVALID_INPUT);
+        REQUIRE(dsa_rotate(arr.data(), arr.size(), sizeof(int), 4) == DSA_INVALID_INPUT);
+    }
+}
+
+TEST_CASE("dsa_rotate matches std::rotate on every strategy", "[dsa_rotate]")
+{
+    // Covers the buffered, juggling and block-swap paths.
+    const size_t elem_size = GENERATE(1, 4, 12, 600);
+    const size_t count = GENERATE(2, 97, 1000, 20000);
+
+    std::vector<unsigned char> bytes(count * elem_size);
+    for (size_t i = 0; i < bytes.size(); i++)
+    {
+        bytes[i] = static_cast<unsigned char>(i * 31 + i / 251);
+    }
+
+    for (size_t middle : {size_t{1}, count / 3, count / 2, count - 1})
+    {
+        if (middle == 0)
+        {
+            continue;
+        }
+
+        std::vector<unsigned char> actual = bytes;
+        std::vector<unsigned char> expected = bytes;
+        std::rotate(expected.begin(), expected.begin() + static_cast<std::ptrdiff_t>(middle * elem_size), expected.end());
+
+        REQUIRE(dsa_rotate(actual.data(), count, elem_size, middle) == DSA_SUCCESS);
+        REQUIRE(actual == expected);
+    }
+}
@@ -0,0 +1,297 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "dsa/common/allocator.h"
+#include "dsa/common/executor.h"
+#include "dsa/utility/scan.h"
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace
+{
+void add_int(void* acc, const void* elem, void*)
+{
+    *static_cast<int*>(acc) += *static_cast<const int*>(elem);
+}
+
+struct Digits
+{
+    char text[200];
+};
+
+// Not commutative, and larger than the stack accumulator.
+void append_text(void* acc, const void* elem, void*)
+{
+    auto* digits = static_cast<Digits*>(acc);
+    const auto* other = static_cast<const Digits*>(elem);
+    std::string joined = std::string(digits->text) + other->text;
+    std::snprintf(digits->text, sizeof(digits->text), "%s", joined.c_str());
+}
+
+struct Stats
+{
+    double sum;
+    double max;
+    int64_t count;
+};
+
+// Works on the accumulator through typed pointers, which requires it to be suitably aligned.
+void accumulate_stats(void* acc, const void* elem, void*)
+{
+    auto* stats = static_cast<Stats*>(acc);
+    const auto* other = static_cast<const Stats*>(elem);
+    stats->sum += other->sum;
+    stats->max = stats->max > other->max ? stats->max : other->max;
+    stats->count += other->count;
+}
+
+void add_double(void* acc, const void* elem, void*)
+{
+    *static_cast<double*>(acc) += *static_cast<const double*>(elem);
+}
+
+// Serves a fixed number of allocations from the heap, then fails.
+void* limited_allocate(void* ctx, size_t size)
+{
+    auto* remaining = static_cast<int*>(ctx);
+    if (*remaining == 0)
+    {
+        return nullptr;
+    }
+    --*remaining;
+    return std::malloc(size);
+}
+
+void limited_deallocate(void*, void* ptr, size_t)
+{
+    std::free(ptr);
+}
+
+struct allocation_counts
+{
+    size_t allocations = 0;
+    size_t deallocations = 0;
+};
+
+void* counting_allocate(void* ctx, size_t size)
+{
+    ++static_cast<allocation_counts*>(ctx)->allocations;
+    return std::malloc(size);
+}
+
+void counting_deallocate(void* ctx, void* ptr, size_t)
+{
+    ++static_cast<allocation_counts*>(ctx)->deallocations;
+    std::free(ptr);
+}
+} // namespace
+
+TEST_CASE("Generic scans", "[dsa_scan]")
+{
+    std::array<int, 5> input{1, 2, 3, 4, 5};
+
+    SECTION("Inclusive scan")
+    {
+        std::array<int, 5> output{};
+        REQUIRE(dsa_inclusive_scan(input.data(), output.data(), input.size(), sizeof(int), add_int, nullptr) == DSA_SUCCESS);
+        REQUIRE(output == std::array<int, 5>{1, 3, 6, 10, 15});
+    }
+
+    SECTION("Exclusive scan")
+    {
+        std::array<int, 5> output{};
+        int init = 100;
+        REQUIRE(dsa_exclusive_scan(input.data(), output.data(), input.size(), sizeof(int), &init, add_int, nullptr) == DSA_SUCCESS);
+        REQUIRE(output == std::array<int, 5>{100, 101, 103, 106, 110});
+    }
+
+    SECTION("In place")
+    {
+        std::array<int, 5> copy = input;
+        int init = 0;
+        REQUIRE(dsa_inclusive_scan(input.data(), input.data(), input.size(), sizeof(int), add_int, nullptr) == DSA_SUCCESS);
+        REQUIRE(input == std::array<int, 5>{1, 3, 6, 10, 15});
+        REQUIRE(dsa_exclusive_scan(copy.data(), copy.data(), copy.size(), sizeof(int), &init, add_int, nullptr) == DSA_SUCCESS);
+        REQUIRE(copy == std::array<int, 5>{0, 1, 3, 6, 10});
+    }
+
+    SECTION("Large elements keep the order of operands")
+    {
+        std::array<Digits, 3> digits{{{"a"}, {"b"}, {"c"}}};
+        REQUIRE(dsa_inclusive_scan(digits.data(), digits.data(), digits.size(), sizeof(Digits), append_text, nullptr) == DSA_SUCCESS);
+        REQUIRE(std::string(digits[2].text) == "abc");
+
+        Digits init{"x"};
+        std::array<Digits, 3> letters{{{"a"}, {"b"}, {"c"}}};
+        REQUIRE(dsa_exclusive_scan(letters.data(), letters.data(), letters.size(), sizeof(Digits), &init, append_text, nullptr) == DSA_SUCCESS);
+        REQUIRE(std::string(letters[0].text) == "x");
+        REQUIRE(std::string(letters[2].text) == "xab");
+    }
+
+    SECTION("Invalid input")
+    {
+        std::array<int, 5> output{};
+        int init = 0;
+        REQUIRE(dsa_inclusive_scan(nullptr, output.data(), input.size(), sizeof(int), add_int, nullptr) == DSA_INVALID_INPUT);
+        REQUIRE(dsa_inclusive_scan(input.data(), nullptr, input.size(), sizeof(int), add_int, nullptr) == DSA_INVALID_INPUT);
+        REQUIRE(dsa_inclusive_scan(input.data(), output.data(), 0, sizeof(int), add_int, nullptr) == DSA_INVALID_INPUT);
+        REQUIRE(dsa_inclusive_scan(input.data(), output.data(), input.size(), sizeof(int), nullptr, nullptr) == DSA_INVALID_INPUT);
+        REQUIRE(dsa_exclusive_scan(input.data(), output.data(), input.size(), sizeof(int), nullptr, add_int, nullptr) == DSA_INVALID_INPUT);
+        REQUIRE(dsa_exclusive_scan(input.data(), output.data(), input.size(), 0, &init, add_int, nullptr) == DSA_INVALID_INPUT);
+    }
+}
+
+TEST_CASE("Typed sum scans match sequential results", "[dsa_scan]")
+{
+    const size_t count = GENERATE(size_t{1}, size_t{1000}, size_t{300001});
+    const size_t threads = GENERATE(size_t{1}, size_t{4});
+
+    std::vector<int64_t> ints(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        ints[i] = static_cast<int64_t>(i % 7) - 3;
+    }
+    // Small integers keep the double sums exact, whatever the association.
+    std::vector<double> doubles(ints.begin(), ints.end());
+
+    std::vector<int64_t> expected_inclusive(count);
+    std::inclusive_scan(ints.begin(), ints.end(), expected_inclusive.begin());
+    std::vector<int64_t> expected_exclusive(count);
+    std::exclusive_scan(ints.begin(), ints.end(), expected_exclusive.begin(), int64_t{5});
+
+    dsa_parallel_options_t options{};
+    options.num_threads = threads;
+
+    std::vector<int64_t> int_out(count);
+    REQUIRE(dsa_inclusive_scan_sum_i64(ints.data(), int_out.data(), count, &options) == DSA_SUCCESS);
+    REQUIRE(int_out == expected_inclusive);
+    REQUIRE(dsa_exclusive_scan_sum_i64(ints.data(), int_out.data(), count, 5, &options) == DSA_SUCCESS);
+    REQUIRE(int_out == expected_exclusive);
+
+    std::vector<double> double_out(count);
+    REQUIRE(dsa_inclusive_scan_sum_f64(doubles.data(), double_out.data(), count, &options) == DSA_SUCCESS);
+    REQUIRE(double_out == std::vector<double>(expected_inclusive.begin(), expected_inclusive.end()));
+
+    // In place.
+    REQUIRE(dsa_exclusive_scan_sum_f64(doubles.data(), doubles.data(), count, 5.0, &options) == DSA_SUCCESS);
+    REQUIRE(doubles == std::vector<double>(expected_exclusive.begin(), expected_exclusive.end()));
+
+    REQUIRE(dsa_inclusive_scan_sum_i64(nullptr, int_out.data(), count, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_inclusive_scan_sum_f64(double_out.data(), nullptr, count, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_exclusive_scan_sum_i64(ints.data(), int_out.data(), 0, 0, nullptr) == DSA_INVALID_INPUT);
+}
+
+TEST_CASE("Typed sum scans fall back to a sequential scan when a parallel pass fails", "[dsa_scan]")
+{
+    dsa_executor_t executor = nullptr;
+    const dsa_executor_options_t executor_options{.num_threads = 0, .pin_threads = false, .run_on_caller = true};
+    REQUIRE(dsa_executor_create(&executor, &executor_options) == DSA_SUCCESS);
+
+    const size_t count = 300001;
+    std::vector<int64_t> ints(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        ints[i] = static_cast<int64_t>(i % 7) - 3;
+    }
+    std::vector<int64_t> expected(count);
+    std::exclusive_scan(ints.begin(), ints.end(), expected.begin(), int64_t{5});
+
+    dsa_parallel_options_t options{};
+    options.num_threads = 4;
+    options.executor = executor;
+
+    // The block array is allocated; the first parallel pass then fails to allocate its workers.
+    int remaining = 1;
+    const dsa_allocator_t limited{limited_allocate, nullptr, limited_deallocate, &remaining};
+    REQUIRE(dsa_allocator_set_default(&limited) == DSA_SUCCESS);
+
+    std::vector<int64_t> out(count);
+    const dsa_error_code_t result = dsa_exclusive_scan_sum_i64(ints.data(), out.data(), count, 5, &options);
+
+    REQUIRE(dsa_allocator_set_default(nullptr) == DSA_SUCCESS);
+    dsa_executor_destroy(executor);
+
+    REQUIRE(result == DSA_SUCCESS);
+    REQUIRE(remaining == 0);
+    REQUIRE(out == expected);
+}
+
+TEST_CASE("Scans take scratch memory from the given allocator", "[dsa_scan]")
+{
+    allocation_counts counts;
+    const dsa_allocator_t counting{counting_allocate, nullptr, counting_deallocate, &counts};
+
+    SECTION("Generic scans of large elements")
+    {
+        std::array<Digits, 3> in{{{"1"}, {"2"}, {"3"}}};
+        std::array<Digits, 3> out{};
+        const Digits init{"0"};
+
+        REQUIRE(dsa_inclusive_scan_with_allocator(in.data(), out.data(), in.size(), sizeof(Digits), append_text, nullptr, &counting) ==
+                DSA_SUCCESS);
+        REQUIRE(std::string(out[2].text) == "123");
+        REQUIRE(dsa_exclusive_scan_with_allocator(in.data(), out.data(), in.size(), sizeof(Digits), &init, append_text, nullptr,
+                                                  &counting) == DSA_SUCCESS);
+        REQUIRE(std::string(out[2].text) == "012");
+
+        REQUIRE(counts.allocations == 2);
+        REQUIRE(counts.deallocations == 2);
+    }
+
+    SECTION("Parallel sum scans")
+    {
+        const size_t count = 300001;
+        std::vector<int64_t> ints(count, 1);
+        std::vector<int64_t> out(count);
+
+        dsa_parallel_options_t options{};
+        options.num_threads = 4;
+        options.allocator = &counting;
+
+        REQUIRE(dsa_inclusive_scan_sum_i64(ints.data(), out.data(), count, &options) == DSA_SUCCESS);
+        REQUIRE(out.back() == static_cast<int64_t>(count));
+
+        // The block array, and the worker array of each of the two passes.
+        REQUIRE(counts.allocations == 3);
+        REQUIRE(counts.deallocations == 3);
+    }
+}
+
+TEST_CASE("Generic scans pass an aligned accumulator to the combine function", "[dsa_scan]")
+{
+    SECTION("double")
+    {
+        const std::array<double, 4> in{1.5, 2.0, 0.25, 4.0};
+        std::array<double, 4> out{};
+        const double init = 1.0;
+
+        REQUIRE(dsa_inclusive_scan(in.data(), out.data(), in.size(), sizeof(double), add_double, nullptr) == DSA_SUCCESS);
+        REQUIRE(out == std::array<double, 4>{1.5, 3.5, 3.75, 7.75});
+        REQUIRE(dsa_exclusive_scan(in.data(), out.data(), in.size(), sizeof(double), &init, add_double, nullptr) == DSA_SUCCESS);
+        REQUIRE(out == std::array<double, 4>{1.0, 2.5, 4.5, 4.75});
+    }
+
+    SECTION("Struct of doubles and integers")
+    {
+        const std::array<Stats, 3> in{{{1.0, 1.0, 1}, {3.0, 3.0, 1}, {2.0, 2.0, 1}}};
+        std::array<Stats, 3> out{};
+        const Stats init{0.5, 0.5, 1};
+
+        REQUIRE(dsa_inclusive_scan(in.data(), out.data(), in.size(), sizeof(Stats), accumulate_stats, nullptr) == DSA_SUCCESS);
+        REQUIRE(out[2].sum == 6.0);
+        REQUIRE(out[2].max == 3.0);
+        REQUIRE(out[2].count == 3);
+
+        REQUIRE(dsa_exclusive_scan(in.data(), out.data(), in.size(), sizeof(Stats), &init, accumulate_stats, nullptr) == DSA_SUCCESS);
+        REQUIRE(out[0].sum == 0.5);
+        REQUIRE(out[2].sum == 4.5);
+        REQUIRE(out[2].max == 3.0);
+        REQUIRE(out[2].count == 3);
+    }
+}
@@ -0,0 +1,49 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "dsa/utility/transform.h"
+
+#include <array>
+
+namespace
+{
+void int_to_double_scaled(void* out, const void* in, void* ctx)
+{
+    *static_cast<double*>(out) = *static_cast<const int*>(in) * *static_cast<double*>(ctx);
+}
+
+void square_int(void* out, const void* in, void*)
+{
+    const int value = *static_cast<const int*>(in);
+    *static_cast<int*>(out) = value * value;
+}
+} // namespace
+
+TEST_CASE("dsa_transform writes converted elements", "[dsa_transform]")
+{
+    std::array<int, 4> input{1, 2, 3, 4};
+
+    SECTION("Different input and output types")
+    {
+        std::array<double, 4> output{};
+        double scale = 0.5;
+        REQUIRE(dsa_transform(input.data(), input.size(), sizeof(int), output.data(), sizeof(double), int_to_double_scaled, &scale) == DSA_SUCCESS);
+        REQUIRE(output == std::array<double, 4>{0.5, 1.0, 1.5, 2.0});
+    }
+
+    SECTION("In place")
+    {
+        REQUIRE(dsa_transform(input.data(), input.size(), sizeof(int), input.data(), sizeof(int), square_int, nullptr) == DSA_SUCCESS);
+        REQUIRE(input == std::array<int, 4>{1, 4, 9, 16});
+    }
+
+    SECTION("Invalid input")
+    {
+        std::array<int, 4> output{};
+        REQUIRE(dsa_transform(nullptr, input.size(), sizeof(int), output.data(), sizeof(int), square_int, nullptr) == DSA_INVALID_INPUT);
+        REQUIRE(dsa_transform(input.data(), 0, sizeof(int), output.data(), sizeof(int), square_int, nullptr) == DSA_INVALID_INPUT);
+        REQUIRE(dsa_transform(input.data(), input.size(), 0, output.data(), sizeof(int), square_int, nullptr) == DSA_INVALID_INPUT);
+        REQUIRE(dsa_transform(input.data(), input.size(), sizeof(int), nullptr, sizeof(int), square_int, nullptr) == DSA_INVALID_INPUT);
+        REQUIRE(dsa_transform(input.data(), input.size(), sizeof(int), output.data(), 0, square_int, nullptr) == DSA_INVALID_INPUT);
+        REQUIRE(dsa_transform(input.data(), input.size(), sizeof(int), output.data(), sizeof(int), nullptr, nullptr) == DSA_INVALID_INPUT);
+    }
+}
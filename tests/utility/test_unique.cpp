@@ -0,0 +1,71 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "dsa/utility/unique.h"
+
+#include <array>
+#include <vector>
+
+namespace
+{
+struct Point
+{
+    int x;
+    int y;
+};
+
+int compare_int(const void* a, const void* b)
+{
+    int ia = *static_cast<const int*>(a);
+    int ib = *static_cast<const int*>(b);
+    return (ia > ib) - (ia < ib);
+}
+
+int compare_point_x(const void* a, const void* b)
+{
+    const Point* pa = static_cast<const Point*>(a);
+    const Point* pb = static_cast<const Point*>(b);
+    return (pa->x > pb->x) - (pa->x < pb->x);
+}
+} // namespace
+
+TEST_CASE("dsa_unique removes consecutive duplicates", "[dsa_unique]")
+{
+    SECTION("Runs of duplicates")
+    {
+        std::vector<int> arr{1, 1, 2, 2, 2, 3, 1, 1, 4};
+        size_t new_count = 0;
+        REQUIRE(dsa_unique(arr.data(), arr.size(), sizeof(int), compare_int, &new_count) == DSA_SUCCESS);
+        REQUIRE(new_count == 5);
+        arr.resize(new_count);
+        REQUIRE(arr == std::vector<int>{1, 2, 3, 1, 4});
+    }
+
+    SECTION("No duplicates")
+    {
+        std::array<int, 4> arr{4, 3, 2, 1};
+        size_t new_count = 0;
+        REQUIRE(dsa_unique(arr.data(), arr.size(), sizeof(int), compare_int, &new_count) == DSA_SUCCESS);
+        REQUIRE(new_count == 4);
+        REQUIRE(arr == std::array<int, 4>{4, 3, 2, 1});
+    }
+
+    SECTION("All equal keeps the first element")
+    {
+        std::array<Point, 4> arr{{{5, 0}, {5, 1}, {5, 2}, {5, 3}}};
+        size_t new_count = 0;
+        REQUIRE(dsa_unique(arr.data(), arr.size(), sizeof(Point), compare_point_x, &new_count) == DSA_SUCCESS);
+        REQUIRE(new_count == 1);
+        REQUIRE(arr[0].y == 0);
+    }
+
+    SECTION("Invalid input")
+    {
+        std::array<int, 3> arr{1, 2, 3};
+        size_t new_count = 0;
+        REQUIRE(dsa_unique(nullptr, arr.size(), sizeof(int), compare_int, &new_count) == DSA_INVALID_INPUT);
+        REQUIRE(dsa_unique(arr.data(), 0, sizeof(int), compare_int, &new_count) == DSA_INVALID_INPUT);
+        REQUIRE(dsa_unique(arr.data(), arr.size(), 0, compare_int, &new_count) == DSA_INVALID_INPUT);
+        REQUIRE(dsa_unique(arr.data(), arr.size(), sizeof(int), nullptr, &new_count) == DSA_INVALID_INPUT);
+        REQUIRE(dsa_unique(arr.data(), arr.size(), sizeof(int), compare_int, nullptr) == DSA_INVALID_INPUT);
+    }
+}
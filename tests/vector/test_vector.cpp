@@ -0,0 +1,291 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "dsa/search/binary_search.h"
+#include "dsa/sort/insertion_sort.h"
+#include "dsa/utility/for_each.h"
+#include "dsa/vector/vector.h"
+
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+int compare_ints(const void* a, const void* b)
+{
+    const int lhs = *static_cast<const int*>(a);
+    const int rhs = *static_cast<const int*>(b);
+    return (lhs > rhs) - (lhs < rhs);
+}
+
+struct counting_ctx
+{
+    size_t allocations = 0;
+    size_t live_bytes = 0;
+};
+
+void* counting_allocate(void* ctx, size_t size)
+{
+    auto* counts = static_cast<counting_ctx*>(ctx);
+    ++counts->allocations;
+    counts->live_bytes += size;
+    return std::malloc(size);
+}
+
+void counting_deallocate(void* ctx, void* ptr, size_t size)
+{
+    static_cast<counting_ctx*>(ctx)->live_bytes -= size;
+    std::free(ptr);
+}
+
+void double_int(void* elem)
+{
+    *static_cast<int*>(elem) *= 2;
+}
+
+struct Tracked
+{
+    int value;
+    int* destroyed;
+};
+
+void destroy_tracked(void* elem)
+{
+    ++*static_cast<Tracked*>(elem)->destroyed;
+}
+
+std::vector<int> values_of(vector_t vector)
+{
+    size_t size = 0;
+    void* data = nullptr;
+    REQUIRE(dsa_vector_get_size(vector, &size) == DSA_SUCCESS);
+    REQUIRE(dsa_vector_data(vector, &data) == DSA_SUCCESS);
+    const int* begin = static_cast<const int*>(data);
+    return std::vector<int>(begin, begin + size);
+}
+} // namespace
+
+TEST_CASE("Vector handles invalid input", "[vector][error]")
+{
+    vector_t vector = nullptr;
+    REQUIRE(dsa_vector_create(nullptr, sizeof(int), 0, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_vector_create(&vector, 0, 0, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_vector_create(&vector, sizeof(int), 24, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_vector_create(&vector, sizeof(int), 0, nullptr) == DSA_SUCCESS);
+
+    int value = 1;
+    void* elem = nullptr;
+    REQUIRE(dsa_vector_push_back(vector, nullptr) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_vector_append(vector, &value, 0) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_vector_append(nullptr, &value, 1) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_vector_get_at(vector, 0, &elem) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_vector_swap_remove(vector, 0) == DSA_INVALID_INPUT);
+    REQUIRE(dsa_vector_pop_back(vector) == DSA_EMPTY_LIST);
+    REQUIRE(dsa_vector_data(vector, nullptr) == DSA_INVALID_INPUT);
+
+    dsa_vector_destroy(vector);
+    dsa_vector_destroy(nullptr);
+}
+
+TEST_CASE("Push back and append elements", "[vector]")
+{
+    vector_t vector = nullptr;
+    REQUIRE(dsa_vector_create(&vector, sizeof(int), 0, nullptr) == DSA_SUCCESS);
+
+    bool empty = false;
+    REQUIRE(dsa_vector_is_empty(vector, &empty) == DSA_SUCCESS);
+    REQUIRE(empty);
+
+    std::vector<int> expected;
+    for (int i = 0; i < 100; i++)
+    {
+        REQUIRE(dsa_vector_push_back(vector, &i) == DSA_SUCCESS);
+        expected.push_back(i);
+    }
+
+    std::vector<int> bulk(1000);
+    for (size_t i = 0; i < bulk.size(); i++)
+    {
+        bulk[i] = static_cast<int>(1000 - i);
+    }
+    REQUIRE(dsa_vector_append(vector, bulk.data(), bulk.size()) == DSA_SUCCESS);
+    expected.insert(expected.end(), bulk.begin(), bulk.end());
+
+    REQUIRE(values_of(vector) == expected);
+
+    void* elem = nullptr;
+    REQUIRE(dsa_vector_get_at(vector, 100, &elem) == DSA_SUCCESS);
+    REQUIRE(*static_cast<int*>(elem) == 1000);
+
+    REQUIRE(dsa_vector_pop_back(vector) == DSA_SUCCESS);
+    expected.pop_back();
+    REQUIRE(values_of(vector) == expected);
+
+    dsa_vector_destroy(vector);
+}
+
+TEST_CASE("Growth is geometric", "[vector]")
+{
+    vector_t vector = nullptr;
+    REQUIRE(dsa_vector_create(&vector, sizeof(int), 0, nullptr) == DSA_SUCCESS);
+
+    size_t reallocations = 0;
+    size_t previous_capacity = 0;
+    for (int i = 0; i < 100000; i++)
+    {
+        REQUIRE(dsa_vector_push_back(vector, &i) == DSA_SUCCESS);
+        size_t capacity = 0;
+        REQUIRE(dsa_vector_get_capacity(vector, &capacity) == DSA_SUCCESS);
+        if (capacity != previous_capacity)
+        {
+            ++reallocations;
+            previous_capacity = capacity;
+        }
+    }
+
+    REQUIRE(reallocations < 40);
+
+    dsa_vector_destroy(vector);
+}
+
+TEST_CASE("Reserve and shrink capacity", "[vector]")
+{
+    vector_t vector = nullptr;
+    REQUIRE(dsa_vector_create(&vector, sizeof(int), 0, nullptr) == DSA_SUCCESS);
+
+    size_t capacity = 0;
+    REQUIRE(dsa_vector_reserve(vector, 500) == DSA_SUCCESS);
+    REQUIRE(dsa_vector_get_capacity(vector, &capacity) == DSA_SUCCESS);
+    REQUIRE(capacity == 500);
+
+    std::array<int, 3> values{1, 2, 3};
+    REQUIRE(dsa_vector_append(vector, values.data(), values.size()) == DSA_SUCCESS);
+    REQUIRE(dsa_vector_shrink_to_fit(vector) == DSA_SUCCESS);
+    REQUIRE(dsa_vector_get_capacity(vector, &capacity) == DSA_SUCCESS);
+    REQUIRE(capacity == 3);
+    REQUIRE(values_of(vector) == std::vector<int>{1, 2, 3});
+
+    REQUIRE(dsa_vector_clear(vector) == DSA_SUCCESS);
+    REQUIRE(dsa_vector_shrink_to_fit(vector) == DSA_SUCCESS);
+    REQUIRE(dsa_vector_get_capacity(vector, &capacity) == DSA_SUCCESS);
+    REQUIRE(capacity == 0);
+
+    dsa_vector_destroy(vector);
+}
+
+TEST_CASE("Swap remove moves the last element", "[vector]")
+{
+    vector_t vector = nullptr;
+    REQUIRE(dsa_vector_create(&vector, sizeof(int), 0, nullptr) == DSA_SUCCESS);
+
+    std::array<int, 5> values{10, 20, 30, 40, 50};
+    REQUIRE(dsa_vector_append(vector, values.data(), values.size()) == DSA_SUCCESS);
+
+    REQUIRE(dsa_vector_swap_remove(vector, 1) == DSA_SUCCESS);
+    REQUIRE(values_of(vector) == std::vector<int>{10, 50, 30, 40});
+
+    REQUIRE(dsa_vector_swap_remove(vector, 3) == DSA_SUCCESS);
+    REQUIRE(values_of(vector) == std::vector<int>{10, 50, 30});
+
+    dsa_vector_destroy(vector);
+}
+
+TEST_CASE("Over-aligned storage", "[vector]")
+{
+    constexpr size_t alignment = 64;
+    vector_t vector = nullptr;
+    REQUIRE(dsa_vector_create(&vector, sizeof(double), alignment, nullptr) == DSA_SUCCESS);
+
+    for (int i = 0; i < 1000; i++)
+    {
+        const double value = i;
+        REQUIRE(dsa_vector_push_back(vector, &value) == DSA_SUCCESS);
+
+        void* data = nullptr;
+        REQUIRE(dsa_vector_data(vector, &data) == DSA_SUCCESS);
+        REQUIRE(reinterpret_cast<std::uintptr_t>(data) % alignment == 0);
+    }
+
+    REQUIRE(dsa_vector_shrink_to_fit(vector) == DSA_SUCCESS);
+
+    void* data = nullptr;
+    REQUIRE(dsa_vector_data(vector, &data) == DSA_SUCCESS);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(data) % alignment == 0);
+    REQUIRE(static_cast<double*>(data)[999] == 999.0);
+
+    dsa_vector_destroy(vector);
+}
+
+TEST_CASE("Destroy callback is called for removed elements", "[vector]")
+{
+    int destroyed = 0;
+    vector_t vector = nullptr;
+    REQUIRE(dsa_vector_create(&vector, sizeof(Tracked), 0, destroy_tracked) == DSA_SUCCESS);
+
+    for (int i = 0; i < 5; i++)
+    {
+        const Tracked tracked{i, &destroyed};
+        REQUIRE(dsa_vector_push_back(vector, &tracked) == DSA_SUCCESS);
+    }
+
+    REQUIRE(dsa_vector_pop_back(vector) == DSA_SUCCESS);
+    REQUIRE(dsa_vector_swap_remove(vector, 0) == DSA_SUCCESS);
+    REQUIRE(destroyed == 2);
+
+    dsa_vector_destroy(vector);
+    REQUIRE(destroyed == 5);
+}
+
+TEST_CASE("Vector buffer works with library algorithms", "[vector]")
+{
+    vector_t vector = nullptr;
+    REQUIRE(dsa_vector_create(&vector, sizeof(int), 0, nullptr) == DSA_SUCCESS);
+
+    std::array<int, 6> values{5, 3, 9, 1, 7, 2};
+    REQUIRE(dsa_vector_append(vector, values.data(), values.size()) == DSA_SUCCESS);
+
+    void* data = nullptr;
+    size_t size = 0;
+    REQUIRE(dsa_vector_data(vector, &data) == DSA_SUCCESS);
+    REQUIRE(dsa_vector_get_size(vector, &size) == DSA_SUCCESS);
+
+    REQUIRE(dsa_insertion_sort(data, size, sizeof(int), compare_ints) == DSA_SUCCESS);
+    REQUIRE(values_of(vector) == std::vector<int>{1, 2, 3, 5, 7, 9});
+
+    REQUIRE(dsa_for_each(data, size, sizeof(int), double_int) == DSA_SUCCESS);
+    REQUIRE(values_of(vector) == std::vector<int>{2, 4, 6, 10, 14, 18});
+
+    const int target = 10;
+    size_t index = size;
+    REQUIRE(dsa_binary_search_index(&target, data, size, sizeof(int), compare_ints, &index) == DSA_SUCCESS);
+    REQUIRE(index == 3);
+
+    dsa_vector_destroy(vector);
+}
+
+TEST_CASE("Vector obtains all memory from its allocator", "[vector]")
+{
+    counting_ctx counts;
+    const dsa_allocator_t counting{counting_allocate, nullptr, counting_deallocate, &counts};
+    const size_t alignment = GENERATE(size_t{0}, size_t{64});
+
+    vector_t vector = nullptr;
+    REQUIRE(dsa_vector_create_with_allocator(&vector, sizeof(int), alignment, nullptr, &counting) == DSA_SUCCESS);
+
+    for (int i = 0; i < 100; i++)
+    {
+        REQUIRE(dsa_vector_push_back(vector, &i) == DSA_SUCCESS);
+    }
+    REQUIRE(dsa_vector_shrink_to_fit(vector) == DSA_SUCCESS);
+    REQUIRE(counts.allocations > 1);
+
+    std::vector<int> expected(100);
+    std::iota(expected.begin(), expected.end(), 0);
+    REQUIRE(values_of(vector) == expected);
+
+    dsa_vector_destroy(vector);
+    REQUIRE(counts.live_bytes == 0);
+}